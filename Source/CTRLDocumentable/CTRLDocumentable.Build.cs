@@ -61,6 +61,10 @@ public class CTRLDocumentable : ModuleRules
 				"Engine",
 				"Slate",
 				"SlateCore",
+				"RHI",
+				"RenderCore",
+				"HTTPServer",
+				"ImageWrapper",
 				// ... add private dependencies that you statically link with here ...	
 			}
 			);
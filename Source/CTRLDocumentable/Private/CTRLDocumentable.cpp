@@ -10,6 +10,10 @@
 #include "TaskProcessor.h"
 #include "UI/SDocGeneratorWidget.h"
 #include "GenerationSettings.h"
+#include "Server/NodeImageServer.h"
+#include "DocumentIndex.h"
+#include "Docs/DocumentCache.h"
+#include "Docs/GeneratedDocumentIndex.h"
 
 #include "HAL/IConsoleManager.h"
 #include "Interfaces/IMainFrameModule.h"
@@ -60,6 +64,12 @@ void FCTRLDocumentableModule::StartupModule()
 
 void FCTRLDocumentableModule::ShutdownModule()
 {
+	if(NodeImageServer.IsValid())
+	{
+		NodeImageServer->GT_Stop();
+		NodeImageServer.Reset();
+	}
+
 	FCTRLDocumentableCommands::Unregister();
 }
 
@@ -79,6 +89,74 @@ void FCTRLDocumentableModule::GenerateDocs(FGenerationSettings const& Settings)
 	}
 }
 
+TSharedPtr< FNodeImageServer > FCTRLDocumentableModule::GT_GetNodeImageServer(FGenerationSettings const& Settings)
+{
+	if(NodeImageServer.IsValid() && NodeImageServer->GetPort() == Settings.NodeImageServerPort)
+	{
+		return NodeImageServer;
+	}
+
+	if(NodeImageServer.IsValid())
+	{
+		NodeImageServer->GT_Stop();
+		NodeImageServer.Reset();
+	}
+
+	TSharedPtr< FNodeImageServer > Server = MakeShared< FNodeImageServer >(Settings);
+	if(Server->GT_Start())
+	{
+		NodeImageServer = Server;
+	}
+	return NodeImageServer;
+}
+
+TSharedPtr< const IDocumentIndex > FCTRLDocumentableModule::GetDocumentIndex() const
+{
+	check(IsInGameThread());
+	if(!DocumentIndex.IsValid() && !bTriedDocumentCache)
+	{
+		bTriedDocumentCache = true;
+		DocumentIndex = GT_LoadDocumentCache();
+	}
+	return DocumentIndex;
+}
+
+TSharedPtr< const IDocumentIndex > FCTRLDocumentableModule::GT_LoadDocumentCache() const
+{
+	const FString Path = CTRLDocumentable::GetDocumentCachePath();
+	if(!FPaths::FileExists(Path))
+	{
+		return nullptr;
+	}
+
+	TUniquePtr< FDocCacheReader > Reader = MakeUnique< FDocCacheReader >();
+	if(!Reader->Open(Path))
+	{
+		return nullptr;
+	}
+
+	// Before a single section is touched, a cache of other settings is of no use
+	if(Reader->GetFingerprint() != CTRLDocumentable::GetDocumentCacheFingerprint(UGenerationSettingsObject::Get()->Settings))
+	{
+		UE_LOG(LogCTRLDocumentable, Log, TEXT("Documentation cache was generated with other settings or another engine build, ignoring it"));
+		return nullptr;
+	}
+
+	TSharedRef< FGeneratedDocumentIndex > Index = MakeShared< FGeneratedDocumentIndex >();
+	if(!Index->Open(MoveTemp(Reader)))
+	{
+		return nullptr;
+	}
+	return Index;
+}
+
+void FCTRLDocumentableModule::GT_SetDocumentIndex(TSharedPtr< const IDocumentIndex > InIndex)
+{
+	check(IsInGameThread());
+	DocumentIndex = MoveTemp(InIndex);
+	bTriedDocumentCache = true;
+}
+
 void FCTRLDocumentableModule::ProcessIntermediateDocs(FString const& IntermediateDir, FString const& OutputDir, FString const& DocTitle, bool bCleanOutput)
 {
 }
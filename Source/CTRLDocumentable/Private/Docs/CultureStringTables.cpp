@@ -0,0 +1,201 @@
+// This Source Code Form is subject to the terms of the Mozilla Public
+// License, v. 2.0. If a copy of the MPL was not distributed with this
+// file, You can obtain one at http://mozilla.org/MPL/2.0/.
+
+// Copyright (C) 2023-2025 NTY.studio. All Rights Reserved.
+
+#include "CultureStringTables.h"
+#include "DocComment.h"
+#include "DocumentModel.h"
+#include "CTRLDocumentableLog.h"
+#include "Internationalization/Culture.h"
+#include "Internationalization/TextLocalizationResource.h"
+#include "Interfaces/IPluginManager.h"
+#include "Policies/CondensedJsonPrintPolicy.h"
+#include "Serialization/JsonWriter.h"
+#include "Misc/FileHelper.h"
+#include "HAL/FileManager.h"
+
+
+namespace
+{
+	/** Every localization resource the editor would load for Culture, with its parent cultures filling in what it lacks. */
+	bool LoadCultureResource(FString const& Culture, FTextLocalizationResource& OutResource)
+	{
+		const FCulturePtr CulturePtr = FInternationalization::Get().GetCulture(Culture);
+		if(!CulturePtr.IsValid())
+		{
+			return false;
+		}
+
+		TArray< FString > LocalizationPaths;
+		LocalizationPaths.Append(FPaths::GetEngineLocalizationPaths());
+		LocalizationPaths.Append(FPaths::GetEditorLocalizationPaths());
+		LocalizationPaths.Append(FPaths::GetPropertyNameLocalizationPaths());
+		LocalizationPaths.Append(FPaths::GetToolTipLocalizationPaths());
+		LocalizationPaths.Append(FPaths::GetGameLocalizationPaths());
+		IPluginManager::Get().GetLocalizationPathsForEnabledPlugins(LocalizationPaths);
+
+		// Lower priorities win, the culture itself comes first in its prioritized list
+		const TArray< FString > PrioritizedCultures = CulturePtr->GetPrioritizedParentCultureNames();
+		for(int32 Priority = 0; Priority < PrioritizedCultures.Num(); ++Priority)
+		{
+			for(FString const& Path : LocalizationPaths)
+			{
+				OutResource.LoadFromDirectory(Path / PrioritizedCultures[Priority], Priority);
+			}
+		}
+		return true;
+	}
+
+	/** Text as translated by Resource. Empty if the text isn't localized, or the translation was made for another source string. */
+	FString FindTranslation(FText const& Text, FTextLocalizationResource const& Resource)
+	{
+		const FTextId Id = FTextInspector::GetTextId(Text);
+		FString const* SourceString = FTextInspector::GetSourceString(Text);
+		if(Id.IsEmpty() || !SourceString)
+		{
+			return FString();
+		}
+
+		FTextLocalizationResource::FEntry const* Entry = Resource.Entries.Find(Id);
+		if(!Entry || !Entry->LocalizedString.IsValid() || Entry->SourceStringHash != FTextLocalizationResource::HashString(*SourceString))
+		{
+			return FString();
+		}
+		return *Entry->LocalizedString;
+	}
+
+	FString ResolveTextPart(FString const& Text, FDocTextSource const& Source, TMap< FString, FDocComment >& ParsedDocs)
+	{
+		switch(Source.Part)
+		{
+		case EDocTextPart::Whole:
+			return Text.TrimEnd();
+
+		case EDocTextPart::FirstLines:
+		{
+			int32 End = 0;
+			for(int32 Line = 0; Line < Source.LineCount; ++Line)
+			{
+				const int32 LineEnd = Text.Find(TEXT("\n"), ESearchCase::CaseSensitive, ESearchDir::FromStart, End);
+				if(LineEnd == INDEX_NONE)
+				{
+					End = Text.Len();
+					break;
+				}
+				End = LineEnd + 1;
+			}
+			return Text.Left(End).TrimEnd();
+		}
+
+		default:
+			break;
+		}
+
+		// A doc comment section, each tooltip is parsed once per culture
+		FDocComment const* Doc = ParsedDocs.Find(Text);
+		if(!Doc)
+		{
+			Doc = &ParsedDocs.Add(Text, FDocComment::Parse(Text));
+		}
+
+		switch(Source.Part)
+		{
+		case EDocTextPart::Summary:
+			return Doc->Summary;
+		case EDocTextPart::Return:
+			return Doc->Return;
+		case EDocTextPart::Param:
+			if(FString const* Param = Doc->Params.Find(Source.ParamName))
+			{
+				return *Param;
+			}
+			return FString();
+		default:
+			return FString();
+		}
+	}
+}
+
+
+bool CTRLDocumentable::WriteCultureStringTables(FDocModel const& Model, TArray< FString > const& Cultures, FString const& OutputDir)
+{
+	const FString EditorCulture = FInternationalization::Get().GetCurrentLanguage()->GetName();
+
+	bool bSuccess = true;
+	TArray< FString > Written;
+	for(FString const& Culture : Cultures)
+	{
+		// The docs are already in the editor's language
+		if(Culture.IsEmpty() || Culture == EditorCulture || Written.Contains(Culture))
+		{
+			continue;
+		}
+
+		FTextLocalizationResource Resource;
+		if(!LoadCultureResource(Culture, Resource))
+		{
+			UE_LOG(LogCTRLDocumentable, Warning, TEXT("Unknown culture, no string table written: %s"), *Culture);
+			bSuccess = false;
+			continue;
+		}
+
+		FString Output;
+		TSharedRef< TJsonWriter< TCHAR, TCondensedJsonPrintPolicy< TCHAR > > > Writer = TJsonWriterFactory< TCHAR, TCondensedJsonPrintPolicy< TCHAR > >::Create(&Output);
+		Writer->WriteObjectStart();
+		Writer->WriteValue(TEXT("culture"), Culture);
+		Writer->WriteObjectStart(TEXT("strings"));
+
+		TMap< FString, FDocComment > ParsedDocs;
+		for(auto const& Entry : Model.TextSources)
+		{
+			const FString Translation = FindTranslation(Entry.Value.Text, Resource);
+			if(Translation.IsEmpty())
+			{
+				continue;
+			}
+
+			// Untranslated strings are left out, the viewer keeps the original for them
+			FString const& Original = Model.GetString(Entry.Key);
+			const FString Localized = ResolveTextPart(Translation, Entry.Value, ParsedDocs);
+			if(!Localized.IsEmpty() && !Localized.Equals(Original, ESearchCase::CaseSensitive))
+			{
+				Writer->WriteValue(Original, Localized);
+			}
+		}
+
+		Writer->WriteObjectEnd();
+		Writer->WriteObjectEnd();
+		Writer->Close();
+
+		const FString Path = OutputDir / Culture + TEXT(".json");
+		if(!FFileHelper::SaveStringToFile(Output, *Path, FFileHelper::EEncodingOptions::ForceUTF8WithoutBOM))
+		{
+			UE_LOG(LogCTRLDocumentable, Error, TEXT("Failed to write %s"), *Path);
+			bSuccess = false;
+			continue;
+		}
+		Written.Add(Culture);
+	}
+
+	// Lets the viewer offer only the cultures it can load
+	FString Index;
+	TSharedRef< TJsonWriter< TCHAR, TCondensedJsonPrintPolicy< TCHAR > > > IndexWriter = TJsonWriterFactory< TCHAR, TCondensedJsonPrintPolicy< TCHAR > >::Create(&Index);
+	IndexWriter->WriteObjectStart();
+	IndexWriter->WriteValue(TEXT("source"), EditorCulture);
+	IndexWriter->WriteArrayStart(TEXT("cultures"));
+	for(FString const& Culture : Written)
+	{
+		IndexWriter->WriteValue(Culture);
+	}
+	IndexWriter->WriteArrayEnd();
+	IndexWriter->WriteObjectEnd();
+	IndexWriter->Close();
+	if(!FFileHelper::SaveStringToFile(Index, *(OutputDir / TEXT("index.json")), FFileHelper::EEncodingOptions::ForceUTF8WithoutBOM))
+	{
+		UE_LOG(LogCTRLDocumentable, Error, TEXT("Failed to write %s"), *(OutputDir / TEXT("index.json")));
+		bSuccess = false;
+	}
+	return bSuccess;
+}
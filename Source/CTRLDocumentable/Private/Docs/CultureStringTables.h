@@ -0,0 +1,22 @@
+// This Source Code Form is subject to the terms of the Mozilla Public
+// License, v. 2.0. If a copy of the MPL was not distributed with this
+// file, You can obtain one at http://mozilla.org/MPL/2.0/.
+
+// Copyright (C) 2023-2025 NTY.studio. All Rights Reserved.
+
+#pragma once
+
+#include "CoreMinimal.h"
+
+class FDocModel;
+
+
+namespace CTRLDocumentable
+{
+	/**
+	 * Writes <OutputDir>/<culture>.json for each culture, mapping each localizable string of the model to its translation,
+	 * and <OutputDir>/index.json listing the cultures written. Translations are looked up in each culture's localization
+	 * resources directly, the editor language is never switched. Only the model's texts are resolved again, nothing is regenerated.
+	 */
+	bool WriteCultureStringTables(FDocModel const& Model, TArray< FString > const& Cultures, FString const& OutputDir);
+}
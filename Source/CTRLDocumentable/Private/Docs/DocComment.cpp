@@ -0,0 +1,152 @@
+// This Source Code Form is subject to the terms of the Mozilla Public
+// License, v. 2.0. If a copy of the MPL was not distributed with this
+// file, You can obtain one at http://mozilla.org/MPL/2.0/.
+
+// Copyright (C) 2023-2025 NTY.studio. All Rights Reserved.
+
+#include "DocComment.h"
+#include "FieldTextCache.h"
+#include "UObject/Class.h"
+#include "Misc/ScopeRWLock.h"
+
+
+namespace
+{
+	FStringView SplitWord(FStringView Text, FStringView& OutRest)
+	{
+		int32 End = 0;
+		while(End < Text.Len() && !FChar::IsWhitespace(Text[End]))
+		{
+			++End;
+		}
+		OutRest = Text.RightChop(End).TrimStart();
+		return Text.Left(End);
+	}
+
+	void AppendCollapsed(FString& Out, FStringView Text)
+	{
+		bool bPendingSpace = !Out.IsEmpty();
+		for(TCHAR Char : Text)
+		{
+			if(FChar::IsWhitespace(Char))
+			{
+				bPendingSpace = !Out.IsEmpty();
+				continue;
+			}
+			if(bPendingSpace)
+			{
+				Out.AppendChar(TEXT(' '));
+				bPendingSpace = false;
+			}
+			Out.AppendChar(Char);
+		}
+	}
+}
+
+
+FDocComment FDocComment::Parse(FStringView Text)
+{
+	FDocComment Result;
+
+	enum class ESection : uint8 { Summary, Param, Return, Tag };
+	ESection Section = ESection::Summary;
+	FString SectionName;
+	FString SectionText;
+
+	auto Commit = [&]
+	{
+		switch(Section)
+		{
+		case ESection::Summary:
+			Result.Summary = MoveTemp(SectionText);
+			break;
+		case ESection::Param:
+			Result.Params.Add(MoveTemp(SectionName), MoveTemp(SectionText));
+			break;
+		case ESection::Return:
+			Result.Return = MoveTemp(SectionText);
+			break;
+		case ESection::Tag:
+			Result.Tags.Emplace(MoveTemp(SectionName), MoveTemp(SectionText));
+			break;
+		}
+		SectionName.Reset();
+		SectionText.Reset();
+	};
+
+	int32 Pos = 0;
+	while(Pos < Text.Len())
+	{
+		int32 End = Pos;
+		while(End < Text.Len() && Text[End] != TEXT('\n'))
+		{
+			++End;
+		}
+		const FStringView Line = Text.Mid(Pos, End - Pos).TrimStartAndEnd();
+		Pos = End + 1;
+
+		if(Line.Len() > 1 && Line[0] == TEXT('@'))
+		{
+			FStringView Rest;
+			const FStringView Tag = SplitWord(Line.RightChop(1), Rest);
+
+			Commit();
+			if(Tag.Equals(TEXT("param"), ESearchCase::IgnoreCase))
+			{
+				Section = ESection::Param;
+				SectionName = FString(SplitWord(Rest, Rest));
+			}
+			else if(Tag.Equals(TEXT("return"), ESearchCase::IgnoreCase) || Tag.Equals(TEXT("returns"), ESearchCase::IgnoreCase))
+			{
+				Section = ESection::Return;
+			}
+			else
+			{
+				Section = ESection::Tag;
+				SectionName = FString(Tag);
+			}
+			AppendCollapsed(SectionText, Rest);
+			continue;
+		}
+
+		AppendCollapsed(SectionText, Line);
+	}
+	Commit();
+
+	return Result;
+}
+
+FDocCommentCache::FDocCommentCache(FFieldTextCache& InFieldTexts)
+	: FieldTexts(InFieldTexts)
+{}
+
+FDocComment const& FDocCommentCache::Get(const UFunction* Function)
+{
+	const TWeakObjectPtr< const UFunction > Key(Function);
+	{
+		FReadScopeLock ReadLock(Lock);
+		if(TUniquePtr< FDocComment > const* Found = Entries.Find(Key))
+		{
+			return **Found;
+		}
+	}
+
+	// Parsed outside the lock, if two threads race for the same function the first one in wins
+	FText const& ToolTip = FieldTexts.GetToolTip(Function);
+	TUniquePtr< FDocComment > Parsed = MakeUnique< FDocComment >(FDocComment::Parse(ToolTip.ToString()));
+	Parsed->Source = ToolTip;
+
+	FWriteScopeLock WriteLock(Lock);
+	TUniquePtr< FDocComment >& Entry = Entries.FindOrAdd(Key);
+	if(!Entry.IsValid())
+	{
+		Entry = MoveTemp(Parsed);
+	}
+	return *Entry;
+}
+
+void FDocCommentCache::Reset()
+{
+	FWriteScopeLock WriteLock(Lock);
+	Entries.Reset();
+}
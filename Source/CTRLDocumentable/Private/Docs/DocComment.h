@@ -0,0 +1,49 @@
+// This Source Code Form is subject to the terms of the Mozilla Public
+// License, v. 2.0. If a copy of the MPL was not distributed with this
+// file, You can obtain one at http://mozilla.org/MPL/2.0/.
+
+// Copyright (C) 2023-2025 NTY.studio. All Rights Reserved.
+
+#pragma once
+
+#include "CoreMinimal.h"
+#include "UObject/WeakObjectPtrTemplates.h"
+
+class UFunction;
+class FFieldTextCache;
+
+
+/** A function tooltip split into its summary and @ tags. Whitespace inside each section is collapsed. */
+struct FDocComment
+{
+	FString Summary;
+	/** @param descriptions by parameter name, case insensitive */
+	TMap< FString, FString > Params;
+	/** @return / @returns */
+	FString Return;
+	/** Any other tags in order of appearance, tag name without the @ */
+	TArray< TPair< FString, FString > > Tags;
+	/** The text this was parsed from, when known */
+	FText Source;
+
+	/** Single pass over the text. */
+	static FDocComment Parse(FStringView Text);
+};
+
+/** Parsed doc comments per function, so each tooltip is only parsed once. Thread safe. */
+class FDocCommentCache
+{
+public:
+	explicit FDocCommentCache(FFieldTextCache& InFieldTexts);
+
+public:
+	FDocComment const& Get(const UFunction* Function);
+	void Reset();
+
+protected:
+	/** Weak keys so a recompiled blueprint function reusing an address isn't mistaken for the old one. */
+	TMap< TWeakObjectPtr< const UFunction >, TUniquePtr< FDocComment > > Entries;
+	FRWLock Lock;
+
+	FFieldTextCache& FieldTexts;
+};
@@ -0,0 +1,291 @@
+// This Source Code Form is subject to the terms of the Mozilla Public
+// License, v. 2.0. If a copy of the MPL was not distributed with this
+// file, You can obtain one at http://mozilla.org/MPL/2.0/.
+
+// Copyright (C) 2023-2025 NTY.studio. All Rights Reserved.
+
+#include "DocumentCache.h"
+#include "SearchIndex.h"
+#include "DocumentModel.h"
+#include "GenerationSettings.h"
+#include "CTRLDocumentableLog.h"
+#include "Algo/StableSort.h"
+#include "HAL/PlatformFileManager.h"
+#include "HAL/FileManager.h"
+#include "Misc/EngineVersion.h"
+#include "Misc/FileHelper.h"
+#include "Misc/Paths.h"
+
+
+namespace
+{
+	const uint32 CacheMagic = 0x43444443;	// 'CDDC'
+	/** Bump whenever a cached record or section changes meaning. Record sizes are checked on their own. */
+	const uint32 CacheVersion = 2;
+	const int64 SectionAlignment = 16;
+
+	struct FFileHeader
+	{
+		uint32 Magic;
+		uint32 Version;
+		uint32 Fingerprint;
+		uint32 NumSections;
+	};
+
+	struct FSectionHeader
+	{
+		EDocCacheSection Id;
+		uint32 RecordSize;
+		int64 Num;
+		/** From the start of the file */
+		int64 Offset;
+	};
+}
+
+
+void FDocCacheWriter::AddSection(EDocCacheSection Id, uint32 RecordSize, int64 Num, const void* Data)
+{
+	FSection& Section = Sections.AddDefaulted_GetRef();
+	Section.Id = Id;
+	Section.RecordSize = RecordSize;
+	Section.Num = Num;
+	Section.Data.SetNumUninitialized(RecordSize * Num);
+	if(Num > 0)
+	{
+		FMemory::Memcpy(Section.Data.GetData(), Data, RecordSize * Num);
+	}
+}
+
+void FDocCacheWriter::AddStrings(EDocCacheSection OffsetsId, EDocCacheSection CharsId, int32 Num, TFunctionRef< FString const&(int32) > GetString)
+{
+	TArray< int32 > Offsets;
+	Offsets.Reserve(Num + 1);
+	TArray< TCHAR > Chars;
+	for(int32 Idx = 0; Idx < Num; ++Idx)
+	{
+		FString const& String = GetString(Idx);
+		Offsets.Add(Chars.Num());
+		Chars.Append(*String, String.Len());
+	}
+	Offsets.Add(Chars.Num());
+
+	AddSection(OffsetsId, Offsets);
+	AddSection(CharsId, Chars);
+}
+
+TArray64< uint8 > FDocCacheWriter::Build(uint32 Fingerprint) const
+{
+	TArray64< uint8 > Output;
+
+	FFileHeader Header{ CacheMagic, CacheVersion, Fingerprint, (uint32)Sections.Num() };
+	Output.Append((const uint8*)&Header, sizeof(Header));
+
+	// Section table first, offsets filled in as the data is laid out behind it
+	const int64 TableOffset = Output.Num();
+	Output.AddZeroed(sizeof(FSectionHeader) * Sections.Num());
+
+	for(int32 Idx = 0; Idx < Sections.Num(); ++Idx)
+	{
+		FSection const& Section = Sections[Idx];
+		Output.AddZeroed(Align(Output.Num(), SectionAlignment) - Output.Num());
+
+		FSectionHeader SectionHeader{ Section.Id, Section.RecordSize, Section.Num, Output.Num() };
+		FMemory::Memcpy(Output.GetData() + TableOffset + Idx * sizeof(FSectionHeader), &SectionHeader, sizeof(SectionHeader));
+		Output.Append(Section.Data);
+	}
+	return Output;
+}
+
+bool FDocCacheReader::Open(FString const& Path)
+{
+	Region.Reset();
+	Bytes.Empty();
+	Base = nullptr;
+	Size = 0;
+	Handle.Reset(FPlatformFileManager::Get().GetPlatformFile().OpenMapped(*Path));
+	if(!Handle.IsValid() || Handle->GetFileSize() < (int64)sizeof(FFileHeader))
+	{
+		Handle.Reset();
+		return false;
+	}
+
+	Region.Reset(Handle->MapRegion(0, Handle->GetFileSize()));
+	if(!Region.IsValid())
+	{
+		Handle.Reset();
+		return false;
+	}
+
+	Base = Region->GetMappedPtr();
+	Size = Region->GetMappedSize();
+	return ReadHeader(Path);
+}
+
+bool FDocCacheReader::Open(TArray64< uint8 >&& InBytes)
+{
+	Region.Reset();
+	Handle.Reset();
+	Bytes = MoveTemp(InBytes);
+	Base = Bytes.GetData();
+	Size = Bytes.Num();
+	return ReadHeader(TEXT("in memory"));
+}
+
+bool FDocCacheReader::ReadHeader(FString const& What)
+{
+	FFileHeader const* Header = Size >= (int64)sizeof(FFileHeader) ? (const FFileHeader*)Base : nullptr;
+	if(!Header || Header->Magic != CacheMagic || Header->Version != CacheVersion
+		|| (int64)(sizeof(FFileHeader) + Header->NumSections * sizeof(FSectionHeader)) > Size)
+	{
+		UE_LOG(LogCTRLDocumentable, Log, TEXT("Ignoring documentation cache from another version: %s"), *What);
+		Region.Reset();
+		Handle.Reset();
+		Bytes.Empty();
+		Base = nullptr;
+		Size = 0;
+		return false;
+	}
+
+	Fingerprint = Header->Fingerprint;
+	return true;
+}
+
+const void* FDocCacheReader::FindSection(EDocCacheSection Id, uint32 RecordSize, int64& OutNum) const
+{
+	if(!Base)
+	{
+		return nullptr;
+	}
+
+	FFileHeader const& Header = *(const FFileHeader*)Base;
+	const FSectionHeader* Table = (const FSectionHeader*)(Base + sizeof(FFileHeader));
+	for(uint32 Idx = 0; Idx < Header.NumSections; ++Idx)
+	{
+		FSectionHeader const& Section = Table[Idx];
+		if(Section.Id != Id)
+		{
+			continue;
+		}
+
+		// A record of another size means the layout changed without a version bump, nothing in it can be trusted
+		if(Section.RecordSize != RecordSize || Section.Num < 0 || Section.Num > MAX_int32 || Section.Offset < 0
+			|| Section.Offset % SectionAlignment != 0 || Section.Offset + Section.Num * (int64)RecordSize > Size)
+		{
+			return nullptr;
+		}
+		OutNum = Section.Num;
+		return Base + Section.Offset;
+	}
+	return nullptr;
+}
+
+bool FDocCacheReader::GetStrings(EDocCacheSection OffsetsId, EDocCacheSection CharsId, FDocStringsView& Out) const
+{
+	return GetSection(OffsetsId, Out.Offsets) && GetSection(CharsId, Out.Chars) && Out.IsValid();
+}
+
+
+FString CTRLDocumentable::GetDocumentCachePath()
+{
+	return FPaths::ProjectSavedDir() / TEXT("CTRLDocumentable") / TEXT("LastGeneration.cdoc");
+}
+
+uint32 CTRLDocumentable::GetDocumentCacheFingerprint(FGenerationSettings const& Settings)
+{
+	uint32 Hash = GetTypeHash(FEngineVersion::Current().ToString());
+	Hash = HashCombine(Hash, GetTypeHash(Settings.DocumentationTitle));
+	for(FName const& Module : Settings.NativeModules)
+	{
+		Hash = HashCombine(Hash, GetTypeHash(Module.ToString()));
+	}
+	for(FDirectoryPath const& Path : Settings.ContentPaths)
+	{
+		Hash = HashCombine(Hash, GetTypeHash(Path.Path));
+	}
+
+	// Which nodes are documented and how their pins read
+	Hash = HashCombine(Hash, GetTypeHash(Settings.BlueprintContextClass ? Settings.BlueprintContextClass->GetPathName() : FString()));
+	for(TSubclassOf< UObject > const& Context : Settings.AdditionalContextClasses)
+	{
+		Hash = HashCombine(Hash, GetTypeHash(Context ? Context->GetPathName() : FString()));
+	}
+
+	// Where each node's image is and how it is cut out of a sheet
+	Hash = HashCombine(Hash, GetTypeHash((uint8)Settings.NodeImageFormat));
+	Hash = HashCombine(Hash, GetTypeHash(Settings.bPackNodeSpriteSheets));
+	Hash = HashCombine(Hash, GetTypeHash(Settings.NodeAtlasSize));
+	Hash = HashCombine(Hash, GetTypeHash(Settings.NodeThumbnailWidth));
+	Hash = HashCombine(Hash, GetTypeHash(Settings.bEmbedImagePlaceholders));
+	Hash = HashCombine(Hash, GetTypeHash(Settings.bRenderNodeImagesOnDemand));
+	return Hash;
+}
+
+TArray64< uint8 > CTRLDocumentable::BuildDocumentCache(FDocModel const& Model, FDocSearchIndex const& SearchIndex, uint32 Fingerprint)
+{
+	FDocCacheWriter Writer;
+
+	// In id order, the empty string at 0 included, so ids index the offsets directly
+	Writer.AddStrings(EDocCacheSection::StringOffsets, EDocCacheSection::StringChars, Model.NumStrings(), [&Model](int32 Idx) -> FString const&
+	{
+		return Model.GetString(Idx);
+	});
+
+	TArray< FDocClassRecord > Classes;
+	TArray< int32 > ClassNodes;
+	Classes.Reserve(Model.Classes.Num());
+	for(FDocClass const& Class : Model.Classes)
+	{
+		Classes.Add(FDocClassRecord{
+			Class.ClassName, Class.Path, Class.HierarchyIndex, Class.Properties, Class.Functions,
+			FDocRange{ ClassNodes.Num(), Class.Nodes.Num() },
+			Class.InheritedProperties, Class.InheritedFunctions, Class.InheritedNodes
+		});
+		ClassNodes.Append(Class.Nodes);
+	}
+	Writer.AddSection(EDocCacheSection::Classes, Classes);
+	Writer.AddSection(EDocCacheSection::ClassNodes, ClassNodes);
+
+	// Grouped by type once here, so a type's usages are one run wherever the cache is read
+	TArray< FDocTypeUsage > TypeUsages = Model.TypeUsages;
+	Algo::StableSort(TypeUsages, [](FDocTypeUsage const& A, FDocTypeUsage const& B)
+	{
+		return A.Type < B.Type;
+	});
+
+	Writer.AddSection(EDocCacheSection::Hierarchy, Model.Hierarchy);
+	Writer.AddSection(EDocCacheSection::HierarchyChildren, Model.HierarchyChildren);
+	Writer.AddSection(EDocCacheSection::InheritedRefs, Model.InheritedRefs);
+	Writer.AddSection(EDocCacheSection::Properties, Model.Properties);
+	Writer.AddSection(EDocCacheSection::Functions, Model.Functions);
+	Writer.AddSection(EDocCacheSection::Parameters, Model.Parameters);
+	Writer.AddSection(EDocCacheSection::Nodes, Model.Nodes);
+	Writer.AddSection(EDocCacheSection::Pins, Model.Pins);
+	Writer.AddSection(EDocCacheSection::Structs, Model.Structs);
+	Writer.AddSection(EDocCacheSection::Enums, Model.Enums);
+	Writer.AddSection(EDocCacheSection::EnumValues, Model.EnumValues);
+	Writer.AddSection(EDocCacheSection::StringLists, Model.StringLists);
+	Writer.AddSection(EDocCacheSection::TypeUsages, TypeUsages);
+
+	SearchIndex.SaveTo(Writer);
+
+	return Writer.Build(Fingerprint);
+}
+
+bool CTRLDocumentable::SaveDocumentCache(TArrayView64< const uint8 > Cache, FString const& Path)
+{
+	IFileManager::Get().MakeDirectory(*FPaths::GetPath(Path), true);
+
+	const FString TempPath = Path + TEXT(".tmp");
+	bool bWritten = false;
+	if(TUniquePtr< FArchive > Ar = TUniquePtr< FArchive >(IFileManager::Get().CreateFileWriter(*TempPath)))
+	{
+		Ar->Serialize(const_cast< uint8* >(Cache.GetData()), Cache.Num());
+		bWritten = Ar->Close();
+	}
+	if(!bWritten || !IFileManager::Get().Move(*Path, *TempPath, true, true))
+	{
+		UE_LOG(LogCTRLDocumentable, Error, TEXT("Failed to write %s"), *Path);
+		return false;
+	}
+	return true;
+}
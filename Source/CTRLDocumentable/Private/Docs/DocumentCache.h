@@ -0,0 +1,140 @@
+// This Source Code Form is subject to the terms of the Mozilla Public
+// License, v. 2.0. If a copy of the MPL was not distributed with this
+// file, You can obtain one at http://mozilla.org/MPL/2.0/.
+
+// Copyright (C) 2023-2025 NTY.studio. All Rights Reserved.
+
+#pragma once
+
+#include "CoreMinimal.h"
+#include "DocumentModel.h"
+#include "Async/MappedFileHandle.h"
+#include <type_traits>
+
+class FDocSearchIndex;
+struct FGenerationSettings;
+
+
+enum class EDocCacheSection : uint32
+{
+	StringOffsets,
+	StringChars,
+	Classes,
+	ClassNodes,
+	Hierarchy,
+	HierarchyChildren,
+	InheritedRefs,
+	Properties,
+	Functions,
+	Parameters,
+	Nodes,
+	Pins,
+	Structs,
+	Enums,
+	EnumValues,
+	StringLists,
+	TypeUsages,
+	SearchEntries,
+	SearchTokenOffsets,
+	SearchTokenChars,
+	SearchTokenPostings,
+	SearchPostings,
+};
+
+/**
+ * Builds a cache file: a header, a table of sections, then each section's records exactly as they sit in memory,
+ * 16 byte aligned. Everything is found by offset, so a reader uses the sections where they lie.
+ */
+class FDocCacheWriter
+{
+public:
+	template < typename T, typename AllocatorType >
+	void AddSection(EDocCacheSection Id, TArray< T, AllocatorType > const& Records)
+	{
+		static_assert(std::is_trivially_copyable_v< T >, "Cached records are copied as raw memory");
+		AddSection(Id, sizeof(T), Records.Num(), Records.GetData());
+	}
+
+	/** Strings as two sections: where each one starts in the chars, with one past the end last, and their chars. */
+	void AddStrings(EDocCacheSection OffsetsId, EDocCacheSection CharsId, int32 Num, TFunctionRef< FString const&(int32) > GetString);
+
+	/** The whole file, to save or to read from memory as it is. */
+	TArray64< uint8 > Build(uint32 Fingerprint) const;
+
+protected:
+	void AddSection(EDocCacheSection Id, uint32 RecordSize, int64 Num, const void* Data);
+
+protected:
+	struct FSection
+	{
+		EDocCacheSection Id;
+		uint32 RecordSize;
+		int64 Num;
+		TArray64< uint8 > Data;
+	};
+	TArray< FSection > Sections;
+};
+
+/**
+ * Hands out the sections of a cache where they lie, either in a mapping of the file or in the bytes just built for it.
+ * Rejects files from another version or with records of another layout. Views stay valid while the reader lives.
+ */
+class FDocCacheReader
+{
+public:
+	/** Maps the file, nothing is read until a section is used. */
+	bool Open(FString const& Path);
+	/** Takes over a cache built by FDocCacheWriter::Build. */
+	bool Open(TArray64< uint8 >&& InBytes);
+
+	uint32 GetFingerprint() const { return Fingerprint; }
+
+	/** The whole cache as opened, to save what was built in memory. */
+	TArrayView64< const uint8 > GetBytes() const { return TArrayView64< const uint8 >(Base, Size); }
+
+	/** Records of a section. False if it is missing or its records don't have T's size. */
+	template < typename T >
+	bool GetSection(EDocCacheSection Id, TArrayView< const T >& Out) const
+	{
+		static_assert(std::is_trivially_copyable_v< T >, "Cached records are copied as raw memory");
+		int64 Num = 0;
+		const void* Data = FindSection(Id, sizeof(T), Num);
+		Out = Data ? TArrayView< const T >((const T*)Data, (int32)Num) : TArrayView< const T >();
+		return Data != nullptr;
+	}
+
+	/** Strings saved by FDocCacheWriter::AddStrings. False if they are missing or their offsets don't fit their chars. */
+	bool GetStrings(EDocCacheSection OffsetsId, EDocCacheSection CharsId, FDocStringsView& Out) const;
+
+protected:
+	bool ReadHeader(FString const& What);
+	const void* FindSection(EDocCacheSection Id, uint32 RecordSize, int64& OutNum) const;
+
+protected:
+	TUniquePtr< IMappedFileHandle > Handle;
+	TUniquePtr< IMappedFileRegion > Region;
+	/** Owned instead of a mapping when read from memory */
+	TArray64< uint8 > Bytes;
+	const uint8* Base = nullptr;
+	int64 Size = 0;
+	uint32 Fingerprint = 0;
+};
+
+
+namespace CTRLDocumentable
+{
+	/** Where the last generation is kept between editor sessions. */
+	FString GetDocumentCachePath();
+
+	/** Identifies what a cache was generated from: the engine build and every setting that reaches the model. */
+	uint32 GetDocumentCacheFingerprint(FGenerationSettings const& Settings);
+
+	/** Lay out everything but the localization sources, which are texts of live objects and can't outlive the session. */
+	TArray64< uint8 > BuildDocumentCache(FDocModel const& Model, FDocSearchIndex const& SearchIndex, uint32 Fingerprint);
+
+	/**
+	 * Written next to Path and moved over it, a reader never maps half a file.
+	 * Fails on Windows while the file at Path is mapped, an index opened from it must be released first.
+	 */
+	bool SaveDocumentCache(TArrayView64< const uint8 > Cache, FString const& Path);
+}
@@ -0,0 +1,74 @@
+// This Source Code Form is subject to the terms of the Mozilla Public
+// License, v. 2.0. If a copy of the MPL was not distributed with this
+// file, You can obtain one at http://mozilla.org/MPL/2.0/.
+
+// Copyright (C) 2023-2025 NTY.studio. All Rights Reserved.
+
+#include "FieldTextCache.h"
+#include "Kismet2/BlueprintEditorUtils.h"
+#include "Internationalization/Culture.h"
+#include "Misc/ScopeRWLock.h"
+
+
+FFieldTextCache::FFieldTextCache()
+{
+	Culture = FName(*FInternationalization::Get().GetCurrentLanguage()->GetName());
+}
+
+FText const& FFieldTextCache::GetToolTip(const FField* Field)
+{
+	return FindOrResolve(Field, EKind::ToolTip, [Field] { return Field->GetToolTipText(); });
+}
+
+FText const& FFieldTextCache::GetToolTip(const UField* Field)
+{
+	return FindOrResolve(Field, EKind::ToolTip, [Field] { return Field->GetToolTipText(); });
+}
+
+FText const& FFieldTextCache::GetDisplayName(const FField* Field)
+{
+	return FindOrResolve(Field, EKind::DisplayName, [Field] { return Field->GetDisplayNameText(); });
+}
+
+FText const& FFieldTextCache::GetDisplayName(const UField* Field)
+{
+	return FindOrResolve(Field, EKind::DisplayName, [Field] { return Field->GetDisplayNameText(); });
+}
+
+FText const& FFieldTextCache::GetFriendlyClassName(const UClass* Class)
+{
+	return FindOrResolve(Class, EKind::FriendlyClassName, [Class] { return FBlueprintEditorUtils::GetFriendlyClassDisplayName(Class); });
+}
+
+void FFieldTextCache::Reset()
+{
+	FWriteScopeLock WriteLock(Lock);
+	TextIndices.Reset();
+	Texts.Empty();
+	Culture = FName(*FInternationalization::Get().GetCurrentLanguage()->GetName());
+}
+
+FText const& FFieldTextCache::FindOrResolve(const void* Field, EKind Kind, TFunctionRef< FText() > Resolve)
+{
+	FKey Key{ Field, NAME_None, Kind };
+	{
+		FReadScopeLock ReadLock(Lock);
+		Key.Culture = Culture;
+		if(int32 const* Index = TextIndices.Find(Key))
+		{
+			return Texts[*Index];
+		}
+	}
+
+	// Resolved outside the lock, if two threads race for the same text the first one in wins
+	const FText Text = Resolve();
+
+	FWriteScopeLock WriteLock(Lock);
+	if(int32 const* Index = TextIndices.Find(Key))
+	{
+		return Texts[*Index];
+	}
+	const int32 Index = Texts.AddElement(Text);
+	TextIndices.Add(Key, Index);
+	return Texts[Index];
+}
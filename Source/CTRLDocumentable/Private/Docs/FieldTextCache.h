@@ -0,0 +1,72 @@
+// This Source Code Form is subject to the terms of the Mozilla Public
+// License, v. 2.0. If a copy of the MPL was not distributed with this
+// file, You can obtain one at http://mozilla.org/MPL/2.0/.
+
+// Copyright (C) 2023-2025 NTY.studio. All Rights Reserved.
+
+#pragma once
+
+#include "CoreMinimal.h"
+#include "Containers/ChunkedArray.h"
+
+class FField;
+class UField;
+class UClass;
+
+
+/**
+ * Localized tooltips and display names of reflected fields, each resolved once per culture.
+ * Inherited members and library functions show up under many classes, this saves redoing
+ * the metadata lookup and text formatting for each of them. Thread safe.
+ */
+class FFieldTextCache
+{
+public:
+	FFieldTextCache();
+
+public:
+	FText const& GetToolTip(const FField* Field);
+	FText const& GetToolTip(const UField* Field);
+	FText const& GetDisplayName(const FField* Field);
+	FText const& GetDisplayName(const UField* Field);
+	/** As FBlueprintEditorUtils::GetFriendlyClassDisplayName */
+	FText const& GetFriendlyClassName(const UClass* Class);
+
+	/** Drop everything, texts may have been edited or the editor language changed since. */
+	void Reset();
+
+protected:
+	enum class EKind : uint8
+	{
+		ToolTip,
+		DisplayName,
+		FriendlyClassName,
+	};
+
+	struct FKey
+	{
+		const void* Field;
+		FName Culture;
+		EKind Kind;
+
+		bool operator==(FKey const& Other) const
+		{
+			return Field == Other.Field && Culture == Other.Culture && Kind == Other.Kind;
+		}
+
+		friend uint32 GetTypeHash(FKey const& Key)
+		{
+			return HashCombine(HashCombine(GetTypeHash(Key.Field), GetTypeHash(Key.Culture)), (uint32)Key.Kind);
+		}
+	};
+
+	FText const& FindOrResolve(const void* Field, EKind Kind, TFunctionRef< FText() > Resolve);
+
+protected:
+	/** Chunked so handed out references stay valid as texts are added. Localized texts follow later culture changes. */
+	TChunkedArray< FText > Texts;
+	TMap< FKey, int32 > TextIndices;
+	/** The editor language as of the last reset */
+	FName Culture;
+	mutable FRWLock Lock;
+};
@@ -0,0 +1,179 @@
+// This Source Code Form is subject to the terms of the Mozilla Public
+// License, v. 2.0. If a copy of the MPL was not distributed with this
+// file, You can obtain one at http://mozilla.org/MPL/2.0/.
+
+// Copyright (C) 2023-2025 NTY.studio. All Rights Reserved.
+
+#include "GeneratedDocumentIndex.h"
+#include "DocumentCache.h"
+#include "CTRLDocumentableLog.h"
+#include "Algo/AllOf.h"
+#include "UObject/Class.h"
+
+
+FGeneratedDocumentIndex::FGeneratedDocumentIndex() = default;
+FGeneratedDocumentIndex::~FGeneratedDocumentIndex() = default;
+
+bool FGeneratedDocumentIndex::Open(TUniquePtr< FDocCacheReader > InReader)
+{
+	Reader = MoveTemp(InReader);
+	bool bValid = Reader.IsValid()
+		&& Reader->GetStrings(EDocCacheSection::StringOffsets, EDocCacheSection::StringChars, Model.Strings)
+		&& Reader->GetSection(EDocCacheSection::Classes, Model.Classes)
+		&& Reader->GetSection(EDocCacheSection::ClassNodes, Model.ClassNodes)
+		&& Reader->GetSection(EDocCacheSection::Hierarchy, Model.Hierarchy)
+		&& Reader->GetSection(EDocCacheSection::HierarchyChildren, Model.HierarchyChildren)
+		&& Reader->GetSection(EDocCacheSection::InheritedRefs, Model.InheritedRefs)
+		&& Reader->GetSection(EDocCacheSection::TypeUsages, Model.TypeUsages)
+		&& Reader->GetSection(EDocCacheSection::Properties, Model.Properties)
+		&& Reader->GetSection(EDocCacheSection::Functions, Model.Functions)
+		&& Reader->GetSection(EDocCacheSection::Parameters, Model.Parameters)
+		&& Reader->GetSection(EDocCacheSection::Nodes, Model.Nodes)
+		&& Reader->GetSection(EDocCacheSection::Pins, Model.Pins)
+		&& Reader->GetSection(EDocCacheSection::Structs, Model.Structs)
+		&& Reader->GetSection(EDocCacheSection::Enums, Model.Enums)
+		&& Reader->GetSection(EDocCacheSection::EnumValues, Model.EnumValues)
+		&& Reader->GetSection(EDocCacheSection::StringLists, Model.StringLists)
+		&& SearchIndex.Open(*Reader);
+
+	// Handed out to editor code as it is, so nothing in it may point outside its tables
+	bValid = bValid
+		&& Model.IsValid()
+		&& Algo::AllOf(SearchIndex.GetEntries(), [this](FDocSearchEntry const& Entry) { return Model.IsValid(Entry); });
+
+	if(!bValid)
+	{
+		UE_LOG(LogCTRLDocumentable, Warning, TEXT("Documentation cache is damaged or from another build, ignoring it"));
+		Reader.Reset();
+		Model = FDocModelView();
+		SearchIndex = FDocSearchIndexView();
+		return false;
+	}
+
+	for(int32 Idx = 0; Idx < Model.Classes.Num(); ++Idx)
+	{
+		ClassesByName.Add(GetTypeHash(Model.GetString(Model.Classes[Idx].ClassName)), Idx);
+	}
+	for(int32 Idx = 0; Idx < Model.Structs.Num(); ++Idx)
+	{
+		StructsByName.Add(GetTypeHash(Model.GetString(Model.Structs[Idx].StructName)), Idx);
+	}
+	for(int32 Idx = 0; Idx < Model.Enums.Num(); ++Idx)
+	{
+		EnumsByName.Add(GetTypeHash(Model.GetString(Model.Enums[Idx].EnumName)), Idx);
+	}
+
+	for(int32 Idx = 0; Idx < Model.Nodes.Num(); ++Idx)
+	{
+		if(Model.Nodes[Idx].Function != 0)
+		{
+			NodesByFunction.Add(GetTypeHash(Model.GetString(Model.Nodes[Idx].Function)), Idx);
+		}
+	}
+
+	// The cache has them grouped by type already, only where each run starts is needed
+	for(int32 First = 0; First < Model.TypeUsages.Num();)
+	{
+		int32 End = First + 1;
+		while(End < Model.TypeUsages.Num() && Model.TypeUsages[End].Type == Model.TypeUsages[First].Type)
+		{
+			++End;
+		}
+		UsageRanges.Add(GetTypeHash(Model.GetString(Model.TypeUsages[First].Type)), FDocRange{ First, End - First });
+		First = End;
+	}
+	return true;
+}
+
+int32 FGeneratedDocumentIndex::FindName(TMultiMap< uint32, int32 > const& ByName, TFunctionRef< FDocStringId(int32) > NameOf, FStringView Name) const
+{
+	for(auto It = ByName.CreateConstKeyIterator(GetTypeHash(Name)); It; ++It)
+	{
+		if(Model.GetString(NameOf(It.Value())).Equals(Name, ESearchCase::CaseSensitive))
+		{
+			return It.Value();
+		}
+	}
+	return INDEX_NONE;
+}
+
+int32 FGeneratedDocumentIndex::FindPrefixed(TMultiMap< uint32, int32 > const& ByName, TFunctionRef< FDocStringId(int32) > NameOf, FStringView Name, std::initializer_list< const TCHAR* > Prefixes) const
+{
+	const int32 Found = FindName(ByName, NameOf, Name);
+	if(Found != INDEX_NONE)
+	{
+		return Found;
+	}
+
+	for(const TCHAR* Prefix : Prefixes)
+	{
+		FString Prefixed(Prefix);
+		Prefixed.Append(Name);
+		const int32 FoundPrefixed = FindName(ByName, NameOf, Prefixed);
+		if(FoundPrefixed != INDEX_NONE)
+		{
+			return FoundPrefixed;
+		}
+	}
+	return INDEX_NONE;
+}
+
+int32 FGeneratedDocumentIndex::FindClass(FStringView ClassName) const
+{
+	return FindPrefixed(ClassesByName, [this](int32 Idx) { return Model.Classes[Idx].ClassName; }, ClassName, { TEXT("U"), TEXT("A") });
+}
+
+int32 FGeneratedDocumentIndex::FindStruct(FStringView StructName) const
+{
+	return FindPrefixed(StructsByName, [this](int32 Idx) { return Model.Structs[Idx].StructName; }, StructName, { TEXT("F") });
+}
+
+int32 FGeneratedDocumentIndex::FindEnum(FStringView EnumName) const
+{
+	// Enums are documented by their object name, which usually starts with the E already
+	return FindPrefixed(EnumsByName, [this](int32 Idx) { return Model.Enums[Idx].EnumName; }, EnumName, { TEXT("E") });
+}
+
+void FGeneratedDocumentIndex::FindNodesForFunction(const UFunction* Function, TArray< int32 >& OutNodes) const
+{
+	OutNodes.Reset();
+	if(!Function)
+	{
+		return;
+	}
+
+	const FString Path = Function->GetPathName();
+	for(auto It = NodesByFunction.CreateConstKeyIterator(GetTypeHash(FStringView(Path))); It; ++It)
+	{
+		if(Model.GetString(Model.Nodes[It.Value()].Function).Equals(Path, ESearchCase::CaseSensitive))
+		{
+			OutNodes.Add(It.Value());
+		}
+	}
+	// Documentation order, as the multimap doesn't keep it
+	OutNodes.Sort();
+}
+
+void FGeneratedDocumentIndex::Search(FStringView Query, int32 MaxResults, TArray< FDocSearchEntry >& OutEntries) const
+{
+	TArray< int32 > Hits;
+	SearchIndex.Search(Query, MaxResults, Hits);
+
+	OutEntries.Reset(Hits.Num());
+	for(int32 Hit : Hits)
+	{
+		OutEntries.Add(SearchIndex.GetEntries()[Hit]);
+	}
+}
+
+TArrayView< const FDocTypeUsage > FGeneratedDocumentIndex::FindTypeUsages(FStringView TypeName) const
+{
+	for(auto It = UsageRanges.CreateConstKeyIterator(GetTypeHash(TypeName)); It; ++It)
+	{
+		if(Model.GetString(Model.TypeUsages[It.Value().First].Type).Equals(TypeName, ESearchCase::CaseSensitive))
+		{
+			return FDocModelView::Slice(Model.TypeUsages, It.Value());
+		}
+	}
+	return TArrayView< const FDocTypeUsage >();
+}
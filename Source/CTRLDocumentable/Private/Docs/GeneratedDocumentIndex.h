@@ -0,0 +1,56 @@
+// This Source Code Form is subject to the terms of the Mozilla Public
+// License, v. 2.0. If a copy of the MPL was not distributed with this
+// file, You can obtain one at http://mozilla.org/MPL/2.0/.
+
+// Copyright (C) 2023-2025 NTY.studio. All Rights Reserved.
+
+#pragma once
+
+#include "CoreMinimal.h"
+#include "DocumentIndex.h"
+#include "SearchIndex.h"
+
+class FDocCacheReader;
+
+
+/**
+ * Serves the lookups straight from a document cache's sections, mapped from disk or still in memory from the run
+ * that built them. Keeps the cache alive while it is referenced; only the name hashes are built when opened.
+ */
+class FGeneratedDocumentIndex: public IDocumentIndex
+{
+public:
+	FGeneratedDocumentIndex();
+	virtual ~FGeneratedDocumentIndex() override;
+
+	/** False if the cache misses sections or they don't fit together, the index is of no use then. */
+	bool Open(TUniquePtr< FDocCacheReader > InReader);
+
+public:
+	virtual FDocModelView const& GetModel() const override { return Model; }
+	virtual int32 FindClass(FStringView ClassName) const override;
+	virtual int32 FindStruct(FStringView StructName) const override;
+	virtual int32 FindEnum(FStringView EnumName) const override;
+	virtual void FindNodesForFunction(const UFunction* Function, TArray< int32 >& OutNodes) const override;
+	virtual void Search(FStringView Query, int32 MaxResults, TArray< FDocSearchEntry >& OutEntries) const override;
+	virtual TArrayView< const FDocTypeUsage > FindTypeUsages(FStringView TypeName) const override;
+
+protected:
+	/** Name as given, then with each of Prefixes in front of it, since documented names carry the C++ prefix */
+	int32 FindPrefixed(TMultiMap< uint32, int32 > const& ByName, TFunctionRef< FDocStringId(int32) > NameOf, FStringView Name, std::initializer_list< const TCHAR* > Prefixes) const;
+	int32 FindName(TMultiMap< uint32, int32 > const& ByName, TFunctionRef< FDocStringId(int32) > NameOf, FStringView Name) const;
+
+protected:
+	TUniquePtr< FDocCacheReader > Reader;
+	FDocModelView Model;
+	FDocSearchIndexView SearchIndex;
+
+	/** Name hash to index in Model.Classes, Model.Structs and Model.Enums */
+	TMultiMap< uint32, int32 > ClassesByName;
+	TMultiMap< uint32, int32 > StructsByName;
+	TMultiMap< uint32, int32 > EnumsByName;
+	/** Function path hash to indices in Model.Nodes */
+	TMultiMap< uint32, int32 > NodesByFunction;
+	/** Type name hash to the run of Model.TypeUsages for that type */
+	TMultiMap< uint32, FDocRange > UsageRanges;
+};
@@ -0,0 +1,64 @@
+// This Source Code Form is subject to the terms of the Mozilla Public
+// License, v. 2.0. If a copy of the MPL was not distributed with this
+// file, You can obtain one at http://mozilla.org/MPL/2.0/.
+
+// Copyright (C) 2023-2025 NTY.studio. All Rights Reserved.
+
+#include "JsonOutput.h"
+#include "CTRLDocumentableLog.h"
+#include "Misc/FileHelper.h"
+#include "HAL/FileManager.h"
+#include "HAL/PlatformFileManager.h"
+
+
+bool CTRLDocumentable::SaveJsonFile(FString const& Output, FString const& Path)
+{
+	if(!FFileHelper::SaveStringToFile(Output, *Path, FFileHelper::EEncodingOptions::ForceUTF8))
+	{
+		UE_LOG(LogCTRLDocumentable, Error, TEXT("Failed to write %s"), *Path);
+		return false;
+	}
+	return true;
+}
+
+CTRLDocumentable::FStagedOutputDirectory::FStagedOutputDirectory(FString const& InOutputDir)
+	: OutputDir(InOutputDir)
+	, StagingDir(InOutputDir + TEXT(".staging"))
+{
+	// Left behind by a run that did not get to clean up
+	IFileManager::Get().DeleteDirectory(*StagingDir, false, true);
+	IFileManager::Get().MakeDirectory(*StagingDir, true);
+}
+
+CTRLDocumentable::FStagedOutputDirectory::~FStagedOutputDirectory()
+{
+	if(!bCommitted)
+	{
+		IFileManager::Get().DeleteDirectory(*StagingDir, false, true);
+	}
+}
+
+bool CTRLDocumentable::FStagedOutputDirectory::Commit()
+{
+	IPlatformFile& PlatformFile = FPlatformFileManager::Get().GetPlatformFile();
+	const FString PreviousDir = OutputDir + TEXT(".previous");
+	IFileManager::Get().DeleteDirectory(*PreviousDir, false, true);
+
+	// Out of the way first, a directory can not be renamed onto another one
+	if(PlatformFile.DirectoryExists(*OutputDir) && !PlatformFile.MoveFile(*PreviousDir, *OutputDir))
+	{
+		UE_LOG(LogCTRLDocumentable, Error, TEXT("Failed to replace %s, it is probably open elsewhere"), *OutputDir);
+		return false;
+	}
+	if(!PlatformFile.MoveFile(*OutputDir, *StagingDir))
+	{
+		UE_LOG(LogCTRLDocumentable, Error, TEXT("Failed to move %s into place"), *StagingDir);
+		// Still better than nothing at all
+		PlatformFile.MoveFile(*OutputDir, *PreviousDir);
+		return false;
+	}
+
+	bCommitted = true;
+	IFileManager::Get().DeleteDirectory(*PreviousDir, false, true);
+	return true;
+}
@@ -0,0 +1,50 @@
+// This Source Code Form is subject to the terms of the Mozilla Public
+// License, v. 2.0. If a copy of the MPL was not distributed with this
+// file, You can obtain one at http://mozilla.org/MPL/2.0/.
+
+// Copyright (C) 2023-2025 NTY.studio. All Rights Reserved.
+
+#pragma once
+
+#include "CoreMinimal.h"
+#include "Policies/CondensedJsonPrintPolicy.h"
+#include "Serialization/JsonWriter.h"
+
+
+namespace CTRLDocumentable
+{
+	/** Generated files are for the viewer to parse, whitespace would only make them bigger */
+	typedef TJsonWriter< TCHAR, TCondensedJsonPrintPolicy< TCHAR > > FCondensedJsonWriter;
+
+	inline TSharedRef< FCondensedJsonWriter > MakeCondensedJsonWriter(FString& Output)
+	{
+		return TJsonWriterFactory< TCHAR, TCondensedJsonPrintPolicy< TCHAR > >::Create(&Output);
+	}
+
+	/** Saves Output as UTF-8, logs an error on failure. */
+	bool SaveJsonFile(FString const& Output, FString const& Path);
+
+	/**
+	 * A directory of generated files that replaces the previous one as a whole. Files are written to a sibling
+	 * staging directory and only swapped in by Commit, so shards of a previous run never survive into this one
+	 * and a failed or cancelled run leaves the viewer with the previous output rather than half of each.
+	 */
+	class FStagedOutputDirectory
+	{
+	public:
+		explicit FStagedOutputDirectory(FString const& InOutputDir);
+		/** Removes the staging directory when Commit was never reached */
+		~FStagedOutputDirectory();
+
+		/** Where to write the files until Commit */
+		FString const& GetDir() const { return StagingDir; }
+
+		/** Moves the staged files in place of the previous output. */
+		bool Commit();
+
+	private:
+		FString OutputDir;
+		FString StagingDir;
+		bool bCommitted = false;
+	};
+}
@@ -0,0 +1,131 @@
+// This Source Code Form is subject to the terms of the Mozilla Public
+// License, v. 2.0. If a copy of the MPL was not distributed with this
+// file, You can obtain one at http://mozilla.org/MPL/2.0/.
+
+// Copyright (C) 2023-2025 NTY.studio. All Rights Reserved.
+
+#include "NavigationTree.h"
+#include "DocumentModel.h"
+#include "JsonOutput.h"
+#include "Algo/Sort.h"
+
+
+namespace
+{
+	class FNavTree
+	{
+	public:
+		struct FBranch
+		{
+			FString Name;
+			FString Path;
+			int32 Count = 0;
+			/** What a leaf documents, empty for branches */
+			const TCHAR* Kind = TEXT("");
+			int32 Index = INDEX_NONE;
+			TMap< FString, int32 > ChildIds;
+		};
+
+	public:
+		FNavTree()
+		{
+			Branches.AddDefaulted();
+		}
+
+		/** Count one entry under every branch on Segments, creating them as needed. Returns the last branch. */
+		int32 Add(TArrayView< const FString > Segments)
+		{
+			int32 Current = 0;
+			++Branches[Current].Count;
+			for(FString const& Segment : Segments)
+			{
+				int32 const* Found = Branches[Current].ChildIds.Find(Segment);
+				int32 Child = Found ? *Found : INDEX_NONE;
+				if(Child == INDEX_NONE)
+				{
+					FBranch Branch;
+					Branch.Name = Segment;
+					Branch.Path = Current == 0 ? Segment : Branches[Current].Path / Segment;
+					Child = Branches.Add(MoveTemp(Branch));
+					Branches[Current].ChildIds.Add(Segment, Child);
+				}
+				Current = Child;
+				++Branches[Current].Count;
+			}
+			return Current;
+		}
+
+		void Write(CTRLDocumentable::FCondensedJsonWriter& Writer, int32 BranchIdx) const
+		{
+			FBranch const& Branch = Branches[BranchIdx];
+			Writer.WriteValue(TEXT("name"), Branch.Name);
+			Writer.WriteValue(TEXT("path"), Branch.Path);
+			Writer.WriteValue(TEXT("count"), Branch.Count);
+			if(Branch.Index != INDEX_NONE)
+			{
+				Writer.WriteValue(TEXT("kind"), Branch.Kind);
+				Writer.WriteValue(TEXT("index"), Branch.Index);
+			}
+			if(Branch.ChildIds.Num() == 0)
+			{
+				return;
+			}
+
+			TArray< int32 > Children;
+			Branch.ChildIds.GenerateValueArray(Children);
+			Algo::Sort(Children, [this](int32 A, int32 B)
+			{
+				return Branches[A].Name.Compare(Branches[B].Name, ESearchCase::IgnoreCase) < 0;
+			});
+
+			Writer.WriteArrayStart(TEXT("children"));
+			for(int32 Child : Children)
+			{
+				Writer.WriteObjectStart();
+				Write(Writer, Child);
+				Writer.WriteObjectEnd();
+			}
+			Writer.WriteArrayEnd();
+		}
+
+	public:
+		/** The root is branch 0 */
+		TArray< FBranch > Branches;
+	};
+
+	void AddLeaf(FNavTree& Tree, FString const& Path, const TCHAR* Kind, int32 Index)
+	{
+		TArray< FString > Segments;
+		Path.ParseIntoArray(Segments, TEXT("/"));
+		if(Segments.Num() == 0)
+		{
+			return;
+		}
+
+		FNavTree::FBranch& Leaf = Tree.Branches[Tree.Add(Segments)];
+		Leaf.Kind = Kind;
+		Leaf.Index = Index;
+	}
+}
+
+
+bool CTRLDocumentable::WriteNavigationTree(FDocModel const& Model, FString const& OutputDir)
+{
+	FNavTree Classes;
+	for(int32 Idx = 0; Idx < Model.Classes.Num(); ++Idx)
+	{
+		AddLeaf(Classes, Model.GetString(Model.Classes[Idx].Path), TEXT("class"), Idx);
+	}
+
+	FString Output;
+	TSharedRef< FCondensedJsonWriter > Writer = MakeCondensedJsonWriter(Output);
+	Writer->WriteObjectStart();
+	Writer->WriteObjectStart(TEXT("classes"));
+	Classes.Write(*Writer, 0);
+	Writer->WriteObjectEnd();
+	Writer->WriteObjectEnd();
+	Writer->Close();
+
+	FStagedOutputDirectory Staged(OutputDir);
+	return SaveJsonFile(Output, Staged.GetDir() / TEXT("index.json")) && Staged.Commit();
+}
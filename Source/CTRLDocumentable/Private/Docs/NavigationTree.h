@@ -0,0 +1,22 @@
+// This Source Code Form is subject to the terms of the Mozilla Public
+// License, v. 2.0. If a copy of the MPL was not distributed with this
+// file, You can obtain one at http://mozilla.org/MPL/2.0/.
+
+// Copyright (C) 2023-2025 NTY.studio. All Rights Reserved.
+
+#pragma once
+
+#include "CoreMinimal.h"
+
+class FDocModel;
+
+
+namespace CTRLDocumentable
+{
+	/**
+	 * Writes the viewer's sidebar as a ready made tree to OutputDir/index.json, following the class paths. Branches are
+	 * sorted by name and carry the number of classes below them. The tree has the shape the viewer builds from nodes.json,
+	 * so the sidebar does not change when the full data arrives; structs and enums have no page to lead to and are left out.
+	 */
+	bool WriteNavigationTree(FDocModel const& Model, FString const& OutputDir);
+}
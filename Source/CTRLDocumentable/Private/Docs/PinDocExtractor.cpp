@@ -0,0 +1,142 @@
+// This Source Code Form is subject to the terms of the Mozilla Public
+// License, v. 2.0. If a copy of the MPL was not distributed with this
+// file, You can obtain one at http://mozilla.org/MPL/2.0/.
+
+// Copyright (C) 2023-2025 NTY.studio. All Rights Reserved.
+
+#include "PinDocExtractor.h"
+#include "DocComment.h"
+#include "FieldTextCache.h"
+#include "EdGraphSchema_K2.h"
+#include "K2Node_CallFunction.h"
+#include "K2Node_Variable.h"
+#include "K2Node_StructOperation.h"
+
+
+namespace
+{
+	/** Hover texts usually start with UEdGraphSchema_K2::ConstructBasicPinTooltip's "name, type, blank line" header. */
+	FString StripPinTooltipHeader(FString const& Tooltip, FString const& DisplayName)
+	{
+		if(DisplayName.IsEmpty() || !Tooltip.StartsWith(DisplayName + TEXT("\n"), ESearchCase::CaseSensitive))
+		{
+			return Tooltip;
+		}
+
+		const int32 BodyStart = Tooltip.Find(TEXT("\n\n"), ESearchCase::CaseSensitive, ESearchDir::FromStart, DisplayName.Len());
+		return BodyStart == INDEX_NONE ? FString() : Tooltip.RightChop(BodyStart + 2).TrimStartAndEnd();
+	}
+}
+
+
+FPinDocExtractor::FPinTypeKey::FPinTypeKey(FEdGraphPinType const& Type)
+	: Category(Type.PinCategory)
+	, SubCategory(Type.PinSubCategory)
+	, SubCategoryObject(Type.PinSubCategoryObject)
+	, ValueCategory(Type.PinValueType.TerminalCategory)
+	, ValueSubCategory(Type.PinValueType.TerminalSubCategory)
+	, ValueSubCategoryObject(Type.PinValueType.TerminalSubCategoryObject)
+	, ContainerType(Type.ContainerType)
+	, bIsWeakPointer(Type.bIsWeakPointer)
+	, bIsValueWeakPointer(Type.PinValueType.bTerminalIsWeakPointer)
+{}
+
+bool FPinDocExtractor::FPinTypeKey::operator==(FPinTypeKey const& Other) const
+{
+	return Category == Other.Category
+		&& SubCategory == Other.SubCategory
+		&& SubCategoryObject == Other.SubCategoryObject
+		&& ValueCategory == Other.ValueCategory
+		&& ValueSubCategory == Other.ValueSubCategory
+		&& ValueSubCategoryObject == Other.ValueSubCategoryObject
+		&& ContainerType == Other.ContainerType
+		&& bIsWeakPointer == Other.bIsWeakPointer
+		&& bIsValueWeakPointer == Other.bIsValueWeakPointer;
+}
+
+
+FPinDocExtractor::FPinDocExtractor(FDocCommentCache& InDocComments, FFieldTextCache& InFieldTexts)
+	: DocComments(InDocComments)
+	, FieldTexts(InFieldTexts)
+{}
+
+void FPinDocExtractor::Extract(const UEdGraphPin* Pin, FPinDoc& Out)
+{
+	Out.Name = Pin->GetDisplayName();
+	if(Out.Name.IsEmpty() && Pin->PinType.PinCategory == UEdGraphSchema_K2::PC_Exec)
+	{
+		Out.Name = FText::AsCultureInvariant(Pin->Direction == EEdGraphPinDirection::EGPD_Input ? TEXT("In") : TEXT("Out"));
+	}
+
+	Out.Type = GetTypeText(Pin->PinType);
+	GetDescription(Pin, Out);
+}
+
+void FPinDocExtractor::Reset()
+{
+	TypeTexts.Reset();
+}
+
+FText const& FPinDocExtractor::GetTypeText(FEdGraphPinType const& Type)
+{
+	const FPinTypeKey Key(Type);
+	if(FText const* Found = TypeTexts.Find(Key))
+	{
+		return *Found;
+	}
+	return TypeTexts.Add(Key, UEdGraphSchema_K2::TypeToText(Type));
+}
+
+void FPinDocExtractor::GetDescription(const UEdGraphPin* Pin, FPinDoc& Out) const
+{
+	const UEdGraphNode* Node = Pin->GetOwningNode();
+	Out.DescriptionSource = FDocTextSource();
+
+	// Prefer the doc comment or property the pin stands for
+	const FProperty* Property = nullptr;
+	if(auto CallNode = Cast< UK2Node_CallFunction >(Node))
+	{
+		if(const UFunction* Function = CallNode->GetTargetFunction())
+		{
+			FDocComment const& FunctionDoc = DocComments.Get(Function);
+			const bool bReturn = Pin->PinName == UEdGraphSchema_K2::PN_ReturnValue;
+			FString const* ParamDoc = bReturn ? &FunctionDoc.Return : FunctionDoc.Params.Find(Pin->PinName.ToString());
+			if(ParamDoc && !ParamDoc->IsEmpty())
+			{
+				Out.Description = *ParamDoc;
+				Out.DescriptionSource.Text = FunctionDoc.Source;
+				Out.DescriptionSource.Part = bReturn ? EDocTextPart::Return : EDocTextPart::Param;
+				Out.DescriptionSource.ParamName = bReturn ? FString() : Pin->PinName.ToString();
+				return;
+			}
+		}
+	}
+	else if(auto VariableNode = Cast< UK2Node_Variable >(Node))
+	{
+		Property = Pin->PinName == VariableNode->GetVarName() ? VariableNode->GetPropertyForVariable() : nullptr;
+	}
+	else if(auto StructNode = Cast< UK2Node_StructOperation >(Node))
+	{
+		Property = StructNode->StructType ? FindFProperty< FProperty >(StructNode->StructType, Pin->PinName) : nullptr;
+	}
+
+	if(Property)
+	{
+		FText const& ToolTip = FieldTexts.GetToolTip(Property);
+		if(!ToolTip.IsEmpty())
+		{
+			Out.Description = ToolTip.ToString();
+			Out.DescriptionSource.Text = ToolTip;
+			return;
+		}
+	}
+
+	// Event, macro and most other K2 nodes describe their pins only through the hover text they build
+	FString HoverText;
+	Node->GetPinHoverText(*Pin, HoverText);
+	if(HoverText.IsEmpty())
+	{
+		HoverText = Pin->PinToolTip;
+	}
+	Out.Description = StripPinTooltipHeader(HoverText, Pin->GetDisplayName().ToString());
+}
@@ -0,0 +1,74 @@
+// This Source Code Form is subject to the terms of the Mozilla Public
+// License, v. 2.0. If a copy of the MPL was not distributed with this
+// file, You can obtain one at http://mozilla.org/MPL/2.0/.
+
+// Copyright (C) 2023-2025 NTY.studio. All Rights Reserved.
+
+#pragma once
+
+#include "CoreMinimal.h"
+#include "EdGraph/EdGraphPin.h"
+#include "DocumentModel.h"
+
+class FDocCommentCache;
+class FFieldTextCache;
+
+
+/**
+ * Reads the name, type and description of K2 pins straight from the pin and the function or property behind it.
+ * Only pins with nothing behind them fall back to the node's hover text, with its header stripped.
+ * Type text is memoized per pin type. Not thread safe, used by the processor thread only.
+ */
+class FPinDocExtractor
+{
+public:
+	struct FPinDoc
+	{
+		FText Name;
+		FText Type;
+		FString Description;
+		/** Where Description came from, an empty text if it isn't localized */
+		FDocTextSource DescriptionSource;
+	};
+
+	FPinDocExtractor(FDocCommentCache& InDocComments, FFieldTextCache& InFieldTexts);
+
+public:
+	void Extract(const UEdGraphPin* Pin, FPinDoc& Out);
+	void Reset();
+
+protected:
+	struct FPinTypeKey
+	{
+		FName Category;
+		FName SubCategory;
+		TWeakObjectPtr< UObject > SubCategoryObject;
+		FName ValueCategory;
+		FName ValueSubCategory;
+		TWeakObjectPtr< UObject > ValueSubCategoryObject;
+		EPinContainerType ContainerType;
+		bool bIsWeakPointer;
+		bool bIsValueWeakPointer;
+
+		explicit FPinTypeKey(FEdGraphPinType const& Type);
+
+		bool operator==(FPinTypeKey const& Other) const;
+		friend uint32 GetTypeHash(FPinTypeKey const& Key)
+		{
+			uint32 Hash = HashCombine(GetTypeHash(Key.Category), GetTypeHash(Key.SubCategory));
+			Hash = HashCombine(Hash, GetTypeHash(Key.SubCategoryObject));
+			Hash = HashCombine(Hash, GetTypeHash(Key.ValueCategory));
+			Hash = HashCombine(Hash, GetTypeHash(Key.ValueSubCategory));
+			Hash = HashCombine(Hash, GetTypeHash(Key.ValueSubCategoryObject));
+			return HashCombine(Hash, (uint32)Key.ContainerType | (Key.bIsWeakPointer ? 0x100u : 0u) | (Key.bIsValueWeakPointer ? 0x200u : 0u));
+		}
+	};
+
+	FText const& GetTypeText(FEdGraphPinType const& Type);
+	void GetDescription(const UEdGraphPin* Pin, FPinDoc& Out) const;
+
+protected:
+	FDocCommentCache& DocComments;
+	FFieldTextCache& FieldTexts;
+	TMap< FPinTypeKey, FText > TypeTexts;
+};
@@ -0,0 +1,492 @@
+// This Source Code Form is subject to the terms of the Mozilla Public
+// License, v. 2.0. If a copy of the MPL was not distributed with this
+// file, You can obtain one at http://mozilla.org/MPL/2.0/.
+
+// Copyright (C) 2023-2025 NTY.studio. All Rights Reserved.
+
+#include "SearchIndex.h"
+#include "DocumentCache.h"
+#include "JsonOutput.h"
+#include "Algo/Sort.h"
+#include "Algo/NoneOf.h"
+
+
+namespace
+{
+	// How much a token counts for depending on where it was found
+	const int32 NameWeight = 8;
+	const int32 TitleWeight = 4;
+	const int32 CategoryWeight = 2;
+	const int32 DescriptionWeight = 1;
+
+	/** Bonus for a query word matching a whole token rather than its prefix */
+	const int32 ExactMatchBonus = 4;
+
+	/** Entries per entries/<n>.json, the viewer fetches only the ones holding its results */
+	const int32 EntriesPerShard = 2048;
+
+	struct FRawPosting
+	{
+		int32 Token;
+		int32 Entry;
+		int32 Score;
+	};
+
+	class FIndexBuilder
+	{
+	public:
+		FIndexBuilder(FDocModel const& InModel, TArray< FDocSearchEntry >& InEntries)
+			: Model(InModel)
+			, Entries(InEntries)
+		{}
+
+		int32 AddEntry(EDocEntryKind Kind, int32 Owner, int32 Member, FDocStringId Label)
+		{
+			CurrentEntry = Entries.Add(FDocSearchEntry{ Kind, Owner, Member, Label });
+			AddField(Label, true, NameWeight);
+			return CurrentEntry;
+		}
+
+		void AddField(FDocStringId Text, bool bIdentifier, int32 Weight)
+		{
+			if(Text == 0)
+			{
+				return;
+			}
+
+			Words.Reset();
+			FDocSearchIndex::Tokenize(Model.GetString(Text), bIdentifier, Words);
+			for(FString const& Word : Words)
+			{
+				int32 const* Found = TokenIds.Find(Word);
+				const int32 Token = Found ? *Found : TokenIds.Add(Word, TokenStrings.Add(Word));
+				Raw.Add(FRawPosting{ Token, CurrentEntry, Weight });
+			}
+		}
+
+	public:
+		FDocModel const& Model;
+		TArray< FDocSearchEntry >& Entries;
+		int32 CurrentEntry = INDEX_NONE;
+
+		TMap< FString, int32 > TokenIds;
+		TArray< FString > TokenStrings;
+		TArray< FRawPosting > Raw;
+		TArray< FString > Words;
+	};
+
+	FString GetShardKey(FString const& Token)
+	{
+		const TCHAR First = Token[0];
+		return FChar::IsAlnum(First) && First < 128 ? FString::Chr(First) : FString(TEXT("_"));
+	}
+
+	const TCHAR* GetKindName(EDocEntryKind Kind)
+	{
+		switch(Kind)
+		{
+		case EDocEntryKind::Class:		return TEXT("class");
+		case EDocEntryKind::Property:	return TEXT("property");
+		case EDocEntryKind::Function:	return TEXT("function");
+		case EDocEntryKind::Node:		return TEXT("node");
+		case EDocEntryKind::Struct:		return TEXT("struct");
+		case EDocEntryKind::Enum:		return TEXT("enum");
+		}
+		return TEXT("");
+	}
+}
+
+
+void FDocSearchIndex::Tokenize(FStringView Text, bool bIdentifier, TArray< FString >& OutTokens)
+{
+	auto AddToken = [&OutTokens](FStringView Token)
+	{
+		if(Token.Len() > 1)
+		{
+			OutTokens.Add(FString(Token).ToLower());
+		}
+	};
+
+	int32 Idx = 0;
+	while(Idx < Text.Len())
+	{
+		// Words are runs of letters and digits, underscores only join identifiers
+		while(Idx < Text.Len() && !(FChar::IsAlnum(Text[Idx]) || (bIdentifier && Text[Idx] == TEXT('_'))))
+		{
+			++Idx;
+		}
+		const int32 WordStart = Idx;
+		while(Idx < Text.Len() && (FChar::IsAlnum(Text[Idx]) || (bIdentifier && Text[Idx] == TEXT('_'))))
+		{
+			++Idx;
+		}
+		const FStringView Word = Text.Mid(WordStart, Idx - WordStart);
+		if(Word.IsEmpty())
+		{
+			continue;
+		}
+
+		AddToken(Word);
+		if(!bIdentifier)
+		{
+			continue;
+		}
+
+		// Humps: lower to upper, letter to digit, and the last capital of an acronym starting a new word (HTTPRequest)
+		int32 HumpStart = 0;
+		for(int32 Pos = 1; Pos <= Word.Len(); ++Pos)
+		{
+			bool bBreak = Pos == Word.Len() || Word[Pos] == TEXT('_');
+			if(!bBreak && Word[Pos - 1] != TEXT('_'))
+			{
+				const TCHAR Prev = Word[Pos - 1];
+				const TCHAR Cur = Word[Pos];
+				bBreak = (FChar::IsLower(Prev) && FChar::IsUpper(Cur))
+					|| (FChar::IsDigit(Prev) != FChar::IsDigit(Cur))
+					|| (FChar::IsUpper(Prev) && FChar::IsUpper(Cur) && Pos + 1 < Word.Len() && FChar::IsLower(Word[Pos + 1]));
+			}
+			if(bBreak)
+			{
+				const FStringView Hump = Word.Mid(HumpStart, Pos - HumpStart);
+				if(Hump.Len() < Word.Len())
+				{
+					AddToken(Hump);
+				}
+				HumpStart = Pos < Word.Len() && Word[Pos] == TEXT('_') ? Pos + 1 : Pos;
+			}
+		}
+	}
+}
+
+void FDocSearchIndex::Build(FDocModel const& Model)
+{
+	Reset();
+
+	FIndexBuilder Builder(Model, Entries);
+	for(int32 ClassIndex = 0; ClassIndex < Model.Classes.Num(); ++ClassIndex)
+	{
+		FDocClass const& Class = Model.Classes[ClassIndex];
+		Builder.AddEntry(EDocEntryKind::Class, ClassIndex, INDEX_NONE, Class.ClassName);
+		Builder.AddField(Class.Path, false, CategoryWeight);
+
+		for(int32 Idx = 0; Idx < Class.Properties.Num; ++Idx)
+		{
+			FDocProperty const& Property = Model.Properties[Class.Properties.First + Idx];
+			Builder.AddEntry(EDocEntryKind::Property, ClassIndex, Idx, Property.Name);
+			Builder.AddField(Property.Description, false, DescriptionWeight);
+		}
+
+		for(int32 Idx = 0; Idx < Class.Functions.Num; ++Idx)
+		{
+			FDocFunction const& Function = Model.Functions[Class.Functions.First + Idx];
+			Builder.AddEntry(EDocEntryKind::Function, ClassIndex, Idx, Function.Name);
+			Builder.AddField(Function.Description, false, DescriptionWeight);
+		}
+
+		for(int32 Idx = 0; Idx < Class.Nodes.Num(); ++Idx)
+		{
+			FDocNode const& Node = Model.Nodes[Class.Nodes[Idx]];
+			Builder.AddEntry(EDocEntryKind::Node, ClassIndex, Idx, Node.ShortTitle);
+			Builder.AddField(Node.FullTitle, false, TitleWeight);
+			Builder.AddField(FDocModel::GetNodeCategory(Node), false, CategoryWeight);
+		}
+	}
+
+	for(int32 StructIndex = 0; StructIndex < Model.Structs.Num(); ++StructIndex)
+	{
+		FDocStruct const& Struct = Model.Structs[StructIndex];
+		Builder.AddEntry(EDocEntryKind::Struct, StructIndex, INDEX_NONE, Struct.StructName);
+		Builder.AddField(Struct.Description, false, DescriptionWeight);
+	}
+
+	for(int32 EnumIndex = 0; EnumIndex < Model.Enums.Num(); ++EnumIndex)
+	{
+		FDocEnum const& Enum = Model.Enums[EnumIndex];
+		Builder.AddEntry(EDocEntryKind::Enum, EnumIndex, INDEX_NONE, Enum.EnumName);
+		Builder.AddField(Enum.Description, false, DescriptionWeight);
+	}
+
+	// Token ids in sorted token order, so prefixes are contiguous
+	TArray< int32 > Order;
+	Order.SetNumUninitialized(Builder.TokenStrings.Num());
+	for(int32 Idx = 0; Idx < Order.Num(); ++Idx)
+	{
+		Order[Idx] = Idx;
+	}
+	Algo::Sort(Order, [&Builder](int32 A, int32 B)
+	{
+		return Builder.TokenStrings[A].Compare(Builder.TokenStrings[B], ESearchCase::CaseSensitive) < 0;
+	});
+
+	TArray< int32 > Rank;
+	Rank.SetNumUninitialized(Order.Num());
+	Tokens.Reserve(Order.Num());
+	for(int32 Idx = 0; Idx < Order.Num(); ++Idx)
+	{
+		Rank[Order[Idx]] = Idx;
+		Tokens.Add(MoveTemp(Builder.TokenStrings[Order[Idx]]));
+	}
+
+	// Group by token, fold repeats of a token within one entry into one posting
+	for(FRawPosting& Posting : Builder.Raw)
+	{
+		Posting.Token = Rank[Posting.Token];
+	}
+	Algo::Sort(Builder.Raw, [](FRawPosting const& A, FRawPosting const& B)
+	{
+		return A.Token != B.Token ? A.Token < B.Token : A.Entry < B.Entry;
+	});
+
+	TokenPostings.SetNum(Tokens.Num());
+	Postings.Reserve(Builder.Raw.Num());
+	for(int32 Idx = 0; Idx < Builder.Raw.Num(); ++Idx)
+	{
+		FRawPosting const& Posting = Builder.Raw[Idx];
+		FDocRange& Range = TokenPostings[Posting.Token];
+		if(Range.Num > 0 && Postings.Last().Entry == Posting.Entry)
+		{
+			Postings.Last().Score += Posting.Score;
+			continue;
+		}
+		if(Range.Num == 0)
+		{
+			Range.First = Postings.Num();
+		}
+		Postings.Add(FDocSearchPosting{ Posting.Entry, Posting.Score });
+		++Range.Num;
+	}
+
+	for(FDocRange const& Range : TokenPostings)
+	{
+		TArrayView< FDocSearchPosting > View(Postings.GetData() + Range.First, Range.Num);
+		Algo::Sort(View, [](FDocSearchPosting const& A, FDocSearchPosting const& B)
+		{
+			return A.Score != B.Score ? A.Score > B.Score : A.Entry < B.Entry;
+		});
+	}
+}
+
+bool FDocSearchIndex::Write(FDocModel const& Model, FString const& OutputDir) const
+{
+	CTRLDocumentable::FStagedOutputDirectory Staged(OutputDir);
+	bool bSuccess = true;
+
+	// Tokens per shard, still in sorted order. '_' collects everything outside a-z and 0-9, which does not sort as one run.
+	TMap< FString, TArray< int32 > > Shards;
+	for(int32 TokenIdx = 0; TokenIdx < Tokens.Num(); ++TokenIdx)
+	{
+		Shards.FindOrAdd(GetShardKey(Tokens[TokenIdx])).Add(TokenIdx);
+	}
+
+	{
+		FString Output;
+		TSharedRef< CTRLDocumentable::FCondensedJsonWriter > Writer = CTRLDocumentable::MakeCondensedJsonWriter(Output);
+		Writer->WriteObjectStart();
+		Writer->WriteArrayStart(TEXT("kinds"));
+		for(EDocEntryKind Kind : { EDocEntryKind::Class, EDocEntryKind::Property, EDocEntryKind::Function, EDocEntryKind::Node, EDocEntryKind::Struct, EDocEntryKind::Enum })
+		{
+			Writer->WriteValue(GetKindName(Kind));
+		}
+		Writer->WriteArrayEnd();
+
+		Writer->WriteArrayStart(TEXT("shards"));
+		for(auto const& Shard : Shards)
+		{
+			Writer->WriteValue(Shard.Key);
+		}
+		Writer->WriteArrayEnd();
+
+		Writer->WriteValue(TEXT("entryCount"), Entries.Num());
+		Writer->WriteValue(TEXT("entriesPerShard"), EntriesPerShard);
+		Writer->WriteObjectEnd();
+		Writer->Close();
+
+		bSuccess &= CTRLDocumentable::SaveJsonFile(Output, Staged.GetDir() / TEXT("index.json"));
+	}
+
+	// [ [kind, owner, member, label], ... ] per run of entries, postings refer to entries by position
+	for(int32 First = 0; First < Entries.Num(); First += EntriesPerShard)
+	{
+		FString Output;
+		TSharedRef< CTRLDocumentable::FCondensedJsonWriter > Writer = CTRLDocumentable::MakeCondensedJsonWriter(Output);
+		Writer->WriteArrayStart();
+		for(int32 Idx = First; Idx < FMath::Min(First + EntriesPerShard, Entries.Num()); ++Idx)
+		{
+			FDocSearchEntry const& Entry = Entries[Idx];
+			Writer->WriteArrayStart();
+			Writer->WriteValue((int32)Entry.Kind);
+			Writer->WriteValue(Entry.Owner);
+			Writer->WriteValue(Entry.Member);
+			Writer->WriteValue(Model.GetString(Entry.Label));
+			Writer->WriteArrayEnd();
+		}
+		Writer->WriteArrayEnd();
+		Writer->Close();
+
+		bSuccess &= CTRLDocumentable::SaveJsonFile(Output, Staged.GetDir() / FString::Printf(TEXT("entries/%d.json"), First / EntriesPerShard));
+	}
+
+	// { "tokens": [ sorted ], "postings": [ [ entry, score, ... ], ... ] } per shard
+	for(auto const& Shard : Shards)
+	{
+		FString Output;
+		TSharedRef< CTRLDocumentable::FCondensedJsonWriter > Writer = CTRLDocumentable::MakeCondensedJsonWriter(Output);
+		Writer->WriteObjectStart();
+		Writer->WriteArrayStart(TEXT("tokens"));
+		for(int32 TokenIdx : Shard.Value)
+		{
+			Writer->WriteValue(Tokens[TokenIdx]);
+		}
+		Writer->WriteArrayEnd();
+
+		Writer->WriteArrayStart(TEXT("postings"));
+		for(int32 TokenIdx : Shard.Value)
+		{
+			FDocRange const& Range = TokenPostings[TokenIdx];
+			Writer->WriteArrayStart();
+			for(FDocSearchPosting const& Posting : TArrayView< const FDocSearchPosting >(Postings.GetData() + Range.First, Range.Num))
+			{
+				Writer->WriteValue(Posting.Entry);
+				Writer->WriteValue(Posting.Score);
+			}
+			Writer->WriteArrayEnd();
+		}
+		Writer->WriteArrayEnd();
+		Writer->WriteObjectEnd();
+		Writer->Close();
+
+		bSuccess &= CTRLDocumentable::SaveJsonFile(Output, Staged.GetDir() / Shard.Key + TEXT(".json"));
+	}
+
+	// A partial index would answer queries wrongly, the previous one stays until a whole one is written
+	return bSuccess && Staged.Commit();
+}
+
+void FDocSearchIndex::SaveTo(FDocCacheWriter& Writer) const
+{
+	Writer.AddSection(EDocCacheSection::SearchEntries, Entries);
+	Writer.AddStrings(EDocCacheSection::SearchTokenOffsets, EDocCacheSection::SearchTokenChars, Tokens.Num(), [this](int32 Idx) -> FString const&
+	{
+		return Tokens[Idx];
+	});
+	Writer.AddSection(EDocCacheSection::SearchTokenPostings, TokenPostings);
+	Writer.AddSection(EDocCacheSection::SearchPostings, Postings);
+}
+
+void FDocSearchIndex::Reset()
+{
+	Entries.Reset();
+	Tokens.Reset();
+	TokenPostings.Reset();
+	Postings.Reset();
+}
+
+bool FDocSearchIndexView::Open(FDocCacheReader const& Reader)
+{
+	const bool bOpened = Reader.GetSection(EDocCacheSection::SearchEntries, Entries)
+		&& Reader.GetStrings(EDocCacheSection::SearchTokenOffsets, EDocCacheSection::SearchTokenChars, Tokens)
+		&& Reader.GetSection(EDocCacheSection::SearchTokenPostings, TokenPostings)
+		&& Reader.GetSection(EDocCacheSection::SearchPostings, Postings)
+		&& TokenPostings.Num() == Tokens.Num()
+		&& Algo::NoneOf(TokenPostings, [this](FDocRange const& Range)
+		{
+			return Range.First < 0 || Range.Num < 0 || Range.First + Range.Num > Postings.Num();
+		})
+		&& Algo::NoneOf(Postings, [this](FDocSearchPosting const& Posting)
+		{
+			return Posting.Entry < 0 || Posting.Entry >= Entries.Num();
+		});
+
+	if(!bOpened)
+	{
+		*this = FDocSearchIndexView();
+	}
+	return bOpened;
+}
+
+int32 FDocSearchIndexView::LowerBound(FStringView Prefix) const
+{
+	int32 Low = 0;
+	int32 High = Tokens.Num();
+	while(Low < High)
+	{
+		const int32 Mid = Low + (High - Low) / 2;
+		if(Tokens.Get(Mid).Compare(Prefix, ESearchCase::CaseSensitive) < 0)
+		{
+			Low = Mid + 1;
+		}
+		else
+		{
+			High = Mid;
+		}
+	}
+	return Low;
+}
+
+void FDocSearchIndexView::Search(FStringView Query, int32 MaxResults, TArray< int32 >& OutEntries) const
+{
+	OutEntries.Reset();
+
+	TArray< FString > Words;
+	FDocSearchIndex::Tokenize(Query, false, Words);
+	if(Words.Num() == 0)
+	{
+		// Single characters are not tokens, but still a usable prefix while typing
+		const FString Trimmed = FString(Query).TrimStartAndEnd().ToLower();
+		if(Trimmed.Len() == 1 && FChar::IsAlnum(Trimmed[0]))
+		{
+			Words.Add(Trimmed);
+		}
+	}
+
+	TMap< int32, int32 > Scores;
+	TMap< int32, int32 > WordScores;
+	for(int32 WordIdx = 0; WordIdx < Words.Num(); ++WordIdx)
+	{
+		FString const& Word = Words[WordIdx];
+
+		// Best score of this word per entry, across every token it is a prefix of
+		WordScores.Reset();
+		for(int32 TokenIdx = LowerBound(Word); TokenIdx < Tokens.Num() && Tokens.Get(TokenIdx).StartsWith(Word, ESearchCase::CaseSensitive); ++TokenIdx)
+		{
+			const int32 Bonus = Tokens.Get(TokenIdx).Len() == Word.Len() ? ExactMatchBonus : 0;
+			for(FDocSearchPosting const& Posting : Postings.Slice(TokenPostings[TokenIdx].First, TokenPostings[TokenIdx].Num))
+			{
+				// Earlier words already ruled out entries missing from their results
+				if(WordIdx > 0 && !Scores.Contains(Posting.Entry))
+				{
+					continue;
+				}
+				int32& Best = WordScores.FindOrAdd(Posting.Entry, 0);
+				Best = FMath::Max(Best, Posting.Score + Bonus);
+			}
+		}
+
+		if(WordIdx == 0)
+		{
+			Scores = WordScores;
+			continue;
+		}
+		for(auto It = Scores.CreateIterator(); It; ++It)
+		{
+			if(int32 const* WordScore = WordScores.Find(It.Key()))
+			{
+				It.Value() += *WordScore;
+			}
+			else
+			{
+				It.RemoveCurrent();
+			}
+		}
+	}
+
+	Scores.ValueStableSort([](int32 A, int32 B) { return A > B; });
+	for(auto const& Entry : Scores)
+	{
+		if(OutEntries.Num() >= MaxResults)
+		{
+			break;
+		}
+		OutEntries.Add(Entry.Key);
+	}
+}
@@ -0,0 +1,77 @@
+// This Source Code Form is subject to the terms of the Mozilla Public
+// License, v. 2.0. If a copy of the MPL was not distributed with this
+// file, You can obtain one at http://mozilla.org/MPL/2.0/.
+
+// Copyright (C) 2023-2025 NTY.studio. All Rights Reserved.
+
+#pragma once
+
+#include "CoreMinimal.h"
+#include "DocumentModel.h"
+
+class FDocCacheWriter;
+class FDocCacheReader;
+
+struct FDocSearchPosting
+{
+	int32 Entry;
+	int32 Score;
+};
+
+
+/**
+ * Inverted index over a document model: every name, title, category and description is split into
+ * lower case tokens, identifiers on their camel case humps as well. Each token lists the entries it
+ * appears in with a score weighted by the field it came from. Tokens are kept sorted so a prefix is a
+ * binary search away, and written sharded by first character so the viewer only fetches what it queries.
+ */
+class FDocSearchIndex
+{
+public:
+	void Build(FDocModel const& Model);
+	/**
+	 * Writes <OutputDir>/index.json with the entry kinds and shard keys, the entries themselves in runs of a fixed size
+	 * as <OutputDir>/entries/<n>.json, and one <OutputDir>/<char>.json per token shard. Replaces the previous output as a whole.
+	 */
+	bool Write(FDocModel const& Model, FString const& OutputDir) const;
+
+	/** Tables as they are, queried from the cache by FDocSearchIndexView without rebuilding. */
+	void SaveTo(FDocCacheWriter& Writer) const;
+
+	void Reset();
+
+	/** Lower case words of Text, identifiers also split on camel case. Single characters are dropped. */
+	static void Tokenize(FStringView Text, bool bIdentifier, TArray< FString >& OutTokens);
+
+protected:
+	TArray< FDocSearchEntry > Entries;
+	/** Sorted */
+	TArray< FString > Tokens;
+	/** Per token, into Postings, best score first */
+	TArray< FDocRange > TokenPostings;
+	TArray< FDocSearchPosting > Postings;
+};
+
+/** A search index saved in a document cache, queried where its tables lie. */
+class FDocSearchIndexView
+{
+public:
+	/** False if the cache has no search index or its tables don't fit together. */
+	bool Open(FDocCacheReader const& Reader);
+
+	/** Entries matching every word of Query, each as a word or a prefix of one, best first. */
+	void Search(FStringView Query, int32 MaxResults, TArray< int32 >& OutEntries) const;
+
+	TArrayView< const FDocSearchEntry > GetEntries() const { return Entries; }
+
+protected:
+	/** Index of the first token not less than Prefix */
+	int32 LowerBound(FStringView Prefix) const;
+
+protected:
+	TArrayView< const FDocSearchEntry > Entries;
+	/** Sorted */
+	FDocStringsView Tokens;
+	TArrayView< const FDocRange > TokenPostings;
+	TArrayView< const FDocSearchPosting > Postings;
+};
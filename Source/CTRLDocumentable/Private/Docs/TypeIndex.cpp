@@ -0,0 +1,124 @@
+// This Source Code Form is subject to the terms of the Mozilla Public
+// License, v. 2.0. If a copy of the MPL was not distributed with this
+// file, You can obtain one at http://mozilla.org/MPL/2.0/.
+
+// Copyright (C) 2023-2025 NTY.studio. All Rights Reserved.
+
+#include "TypeIndex.h"
+#include "DocumentModel.h"
+#include "JsonOutput.h"
+#include "Algo/StableSort.h"
+
+
+namespace
+{
+	/** Roughly how many types go in one shard */
+	const int32 TypesPerShard = 256;
+	const int32 MaxShards = 256;
+}
+
+
+uint32 CTRLDocumentable::HashTypeName(FStringView TypeName)
+{
+	uint32 Hash = 2166136261u;
+	for(TCHAR Char : TypeName)
+	{
+		Hash ^= (uint16)Char;
+		Hash *= 16777619u;
+	}
+	return Hash;
+}
+
+bool CTRLDocumentable::WriteTypeIndex(FDocModel const& Model, FString const& OutputDir)
+{
+	// Usages of one type next to each other, the type names in order
+	TArray< int32 > Order;
+	Order.SetNumUninitialized(Model.TypeUsages.Num());
+	for(int32 Idx = 0; Idx < Order.Num(); ++Idx)
+	{
+		Order[Idx] = Idx;
+	}
+	Algo::StableSort(Order, [&Model](int32 A, int32 B)
+	{
+		return Model.GetString(Model.TypeUsages[A].Type).Compare(Model.GetString(Model.TypeUsages[B].Type), ESearchCase::CaseSensitive) < 0;
+	});
+
+	// Runs of Order per type
+	TArray< FDocRange > Types;
+	for(int32 Idx = 0; Idx < Order.Num(); ++Idx)
+	{
+		if(Types.Num() == 0 || Model.TypeUsages[Order[Idx]].Type != Model.TypeUsages[Order[Types.Last().First]].Type)
+		{
+			Types.Add(FDocRange{ Idx, 0 });
+		}
+		++Types.Last().Num;
+	}
+
+	const int32 NumShards = FMath::Clamp((int32)FMath::RoundUpToPowerOfTwo((uint32)FMath::DivideAndRoundUp(Types.Num(), TypesPerShard)), 1, MaxShards);
+
+	FStagedOutputDirectory Staged(OutputDir);
+	bool bSuccess = true;
+	{
+		FString Output;
+		TSharedRef< FCondensedJsonWriter > Writer = MakeCondensedJsonWriter(Output);
+		Writer->WriteObjectStart();
+		Writer->WriteArrayStart(TEXT("roles"));
+		Writer->WriteValue(TEXT("property"));
+		Writer->WriteValue(TEXT("parameter"));
+		Writer->WriteValue(TEXT("return"));
+		Writer->WriteValue(TEXT("structMember"));
+		Writer->WriteArrayEnd();
+		Writer->WriteValue(TEXT("shardCount"), NumShards);
+		Writer->WriteArrayStart(TEXT("types"));
+		for(FDocRange const& Type : Types)
+		{
+			Writer->WriteValue(Model.GetString(Model.TypeUsages[Order[Type.First]].Type));
+		}
+		Writer->WriteArrayEnd();
+		Writer->WriteArrayStart(TEXT("counts"));
+		for(FDocRange const& Type : Types)
+		{
+			Writer->WriteValue(Type.Num);
+		}
+		Writer->WriteArrayEnd();
+		Writer->WriteObjectEnd();
+		Writer->Close();
+
+		bSuccess &= SaveJsonFile(Output, Staged.GetDir() / TEXT("index.json"));
+	}
+
+	TArray< TArray< int32 > > Shards;
+	Shards.SetNum(NumShards);
+	for(int32 TypeIdx = 0; TypeIdx < Types.Num(); ++TypeIdx)
+	{
+		const FString& Name = Model.GetString(Model.TypeUsages[Order[Types[TypeIdx].First]].Type);
+		Shards[HashTypeName(Name) & (NumShards - 1)].Add(TypeIdx);
+	}
+
+	for(int32 ShardIdx = 0; ShardIdx < NumShards; ++ShardIdx)
+	{
+		FString Output;
+		TSharedRef< FCondensedJsonWriter > Writer = MakeCondensedJsonWriter(Output);
+		Writer->WriteObjectStart();
+		for(int32 TypeIdx : Shards[ShardIdx])
+		{
+			FDocRange const& Type = Types[TypeIdx];
+			Writer->WriteArrayStart(Model.GetString(Model.TypeUsages[Order[Type.First]].Type));
+			for(int32 Idx = Type.First; Idx < Type.First + Type.Num; ++Idx)
+			{
+				FDocTypeUsage const& Usage = Model.TypeUsages[Order[Idx]];
+				Writer->WriteValue((int32)Usage.Role);
+				Writer->WriteValue(Usage.Owner);
+				Writer->WriteValue(Usage.Member);
+				Writer->WriteValue(Usage.Parameter);
+			}
+			Writer->WriteArrayEnd();
+		}
+		Writer->WriteObjectEnd();
+		Writer->Close();
+
+		bSuccess &= SaveJsonFile(Output, Staged.GetDir() / FString::Printf(TEXT("%d.json"), ShardIdx));
+	}
+
+	return bSuccess && Staged.Commit();
+}
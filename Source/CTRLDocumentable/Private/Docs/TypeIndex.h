@@ -0,0 +1,25 @@
+// This Source Code Form is subject to the terms of the Mozilla Public
+// License, v. 2.0. If a copy of the MPL was not distributed with this
+// file, You can obtain one at http://mozilla.org/MPL/2.0/.
+
+// Copyright (C) 2023-2025 NTY.studio. All Rights Reserved.
+
+#pragma once
+
+#include "CoreMinimal.h"
+
+class FDocModel;
+
+
+namespace CTRLDocumentable
+{
+	/** FNV-1a over the UTF-16 code units of a type name, picks its type index shard. The viewer hashes the same way. */
+	uint32 HashTypeName(FStringView TypeName);
+
+	/**
+	 * Writes the model's type usages grouped by type: <OutputDir>/index.json lists every type with its usage count,
+	 * and <OutputDir>/<n>.json holds the usages of the types hashing to shard n, as flat [role, owner, member, parameter] runs.
+	 * Replaces the previous output as a whole.
+	 */
+	bool WriteTypeIndex(FDocModel const& Model, FString const& OutputDir);
+}
@@ -0,0 +1,727 @@
+// This Source Code Form is subject to the terms of the Mozilla Public
+// License, v. 2.0. If a copy of the MPL was not distributed with this
+// file, You can obtain one at http://mozilla.org/MPL/2.0/.
+
+// Copyright (C) 2023-2025 NTY.studio. All Rights Reserved.
+
+#include "DocumentModel.h"
+#include "Algo/AllOf.h"
+#include "Algo/Sort.h"
+#include "Algo/StableSort.h"
+#include "Policies/CondensedJsonPrintPolicy.h"
+#include "Serialization/JsonWriter.h"
+
+
+namespace
+{
+	typedef TJsonWriter< TCHAR, TCondensedJsonPrintPolicy< TCHAR > > FDocJsonWriter;
+
+	/** Keywords, primitives and the templates wrapping a type. Only what they wrap is worth indexing. */
+	bool IsTypeNameSkipped(FString const& Name)
+	{
+		static const TSet< FString > Skipped = {
+			TEXT("const"), TEXT("class"), TEXT("struct"), TEXT("enum"), TEXT("unsigned"), TEXT("signed"),
+			TEXT("void"), TEXT("bool"), TEXT("char"), TEXT("short"), TEXT("int"), TEXT("long"), TEXT("float"), TEXT("double"), TEXT("TCHAR"),
+			TEXT("int8"), TEXT("int16"), TEXT("int32"), TEXT("int64"), TEXT("uint8"), TEXT("uint16"), TEXT("uint32"), TEXT("uint64"),
+			TEXT("TArray"), TEXT("TMap"), TEXT("TSet"), TEXT("TOptional"), TEXT("TEnumAsByte"), TEXT("TFieldPath"), TEXT("TScriptInterface"),
+			TEXT("TObjectPtr"), TEXT("TSubclassOf"), TEXT("TWeakObjectPtr"), TEXT("TSoftObjectPtr"), TEXT("TSoftClassPtr"), TEXT("TLazyObjectPtr"),
+			TEXT("TSharedPtr"), TEXT("TSharedRef"), TEXT("TWeakPtr"), TEXT("TUniquePtr")
+		};
+		return Skipped.Contains(Name);
+	}
+
+	/** For views read from disk, whose ranges and indices can't be trusted */
+	bool IsInRange(FDocRange Range, int32 Num)
+	{
+		return Range.First >= 0 && Range.Num >= 0 && Range.First <= Num - Range.Num;
+	}
+
+	bool IsIndex(int32 Idx, int32 Num)
+	{
+		return Idx >= 0 && Idx < Num;
+	}
+
+	bool IsIndexOrNone(int32 Idx, int32 Num)
+	{
+		return Idx == INDEX_NONE || IsIndex(Idx, Num);
+	}
+
+	void WriteStringList(FDocJsonWriter& Writer, FDocModel const& Model, FString const& Field, FDocRange Range)
+	{
+		Writer.WriteArrayStart(Field);
+		for(FDocStringId Id : FDocModel::Slice(Model.StringLists, Range))
+		{
+			Writer.WriteValue(Model.GetString(Id));
+		}
+		Writer.WriteArrayEnd();
+	}
+
+	void WritePins(FDocJsonWriter& Writer, FDocModel const& Model, FString const& Field, FDocRange Range)
+	{
+		Writer.WriteArrayStart(Field);
+		for(FDocPin const& Pin : FDocModel::Slice(Model.Pins, Range))
+		{
+			Writer.WriteObjectStart();
+			Writer.WriteValue(TEXT("name"), Model.GetString(Pin.Name));
+			Writer.WriteValue(TEXT("type"), Model.GetString(Pin.Type));
+			Writer.WriteValue(TEXT("description"), Model.GetString(Pin.Description));
+			if(Pin.Contexts.Num > 0)
+			{
+				WriteStringList(Writer, Model, TEXT("contexts"), Pin.Contexts);
+			}
+			Writer.WriteObjectEnd();
+		}
+		Writer.WriteArrayEnd();
+	}
+
+	void WriteProperties(FDocJsonWriter& Writer, FDocModel const& Model, FDocRange Range)
+	{
+		Writer.WriteArrayStart(TEXT("properties"));
+		for(FDocProperty const& Property : FDocModel::Slice(Model.Properties, Range))
+		{
+			Writer.WriteObjectStart();
+			Writer.WriteValue(TEXT("name"), Model.GetString(Property.Name));
+			Writer.WriteValue(TEXT("type"), Model.GetString(Property.Type));
+			WriteStringList(Writer, Model, TEXT("flags"), Property.Flags);
+			Writer.WriteValue(TEXT("description"), Model.GetString(Property.Description));
+			Writer.WriteObjectEnd();
+		}
+		Writer.WriteArrayEnd();
+	}
+
+	void WriteNode(FDocJsonWriter& Writer, FDocModel const& Model, FDocNode const& Node)
+	{
+		Writer.WriteObjectStart();
+		Writer.WriteValue(TEXT("docsName"), Model.GetString(Node.DocsName));
+		Writer.WriteValue(TEXT("classId"), Model.GetString(Node.ClassId));
+		Writer.WriteValue(TEXT("className"), Model.GetString(Node.ClassName));
+		Writer.WriteValue(TEXT("shortTitle"), Model.GetString(Node.ShortTitle));
+		Writer.WriteValue(TEXT("fullTitle"), Model.GetString(Node.FullTitle));
+		Writer.WriteValue(TEXT("description"), Model.GetString(Node.Description));
+		Writer.WriteValue(TEXT("imgPath"), Model.GetString(Node.ImgPath));
+		if(Node.bImgDeferred)
+		{
+			Writer.WriteValue(TEXT("imgDeferred"), true);
+		}
+		else if(Node.bImgPending)
+		{
+			Writer.WriteValue(TEXT("imgPending"), true);
+		}
+		WritePins(Writer, Model, TEXT("inputs"), Node.Inputs);
+		WritePins(Writer, Model, TEXT("outputs"), Node.Outputs);
+		if(Node.UnavailableIn.Num > 0)
+		{
+			WriteStringList(Writer, Model, TEXT("unavailableIn"), Node.UnavailableIn);
+		}
+
+		if(Node.ImageSize.X > 0 && Node.ImageSize.Y > 0)
+		{
+			Writer.WriteValue(TEXT("width"), Node.ImageSize.X);
+			Writer.WriteValue(TEXT("height"), Node.ImageSize.Y);
+		}
+		if(Node.Placeholder != 0)
+		{
+			Writer.WriteValue(TEXT("placeholder"), Model.GetString(Node.Placeholder));
+		}
+		if(Node.ThumbPath != 0)
+		{
+			Writer.WriteValue(TEXT("thumbPath"), Model.GetString(Node.ThumbPath));
+		}
+		if(Node.bHasSprite)
+		{
+			Writer.WriteObjectStart(TEXT("sprite"));
+			Writer.WriteValue(TEXT("x"), Node.SpriteRect.Min.X);
+			Writer.WriteValue(TEXT("y"), Node.SpriteRect.Min.Y);
+			Writer.WriteValue(TEXT("w"), Node.SpriteRect.Width());
+			Writer.WriteValue(TEXT("h"), Node.SpriteRect.Height());
+			Writer.WriteValue(TEXT("sheetWidth"), Node.SheetSize.X);
+			Writer.WriteValue(TEXT("sheetHeight"), Node.SheetSize.Y);
+			Writer.WriteObjectEnd();
+		}
+		Writer.WriteObjectEnd();
+	}
+
+	/** Flat [class, index, class, index, ...] pairs */
+	void WriteMemberRefs(FDocJsonWriter& Writer, FDocModel const& Model, FString const& Field, FDocRange Range)
+	{
+		Writer.WriteArrayStart(Field);
+		for(FDocMemberRef const& Ref : FDocModel::Slice(Model.InheritedRefs, Range))
+		{
+			Writer.WriteValue(Ref.Class);
+			Writer.WriteValue(Ref.Index);
+		}
+		Writer.WriteArrayEnd();
+	}
+
+	void WriteClass(FDocJsonWriter& Writer, FDocModel const& Model, FDocClass const& Class)
+	{
+		Writer.WriteObjectStart();
+		Writer.WriteValue(TEXT("className"), Model.GetString(Class.ClassName));
+		Writer.WriteValue(TEXT("hierarchyIndex"), Class.HierarchyIndex);
+		Writer.WriteValue(TEXT("path"), Model.GetString(Class.Path));
+
+		WriteProperties(Writer, Model, Class.Properties);
+
+		Writer.WriteArrayStart(TEXT("functions"));
+		for(FDocFunction const& Function : FDocModel::Slice(Model.Functions, Class.Functions))
+		{
+			Writer.WriteObjectStart();
+			Writer.WriteValue(TEXT("name"), Model.GetString(Function.Name));
+			Writer.WriteValue(TEXT("description"), Model.GetString(Function.Description));
+			WriteStringList(Writer, Model, TEXT("flags"), Function.Flags);
+			Writer.WriteValue(TEXT("returnType"), Model.GetString(Function.ReturnType));
+			if(Function.ReturnDescription != 0)
+			{
+				Writer.WriteValue(TEXT("returnDescription"), Model.GetString(Function.ReturnDescription));
+			}
+			Writer.WriteArrayStart(TEXT("parameters"));
+			for(FDocParameter const& Parameter : FDocModel::Slice(Model.Parameters, Function.Parameters))
+			{
+				Writer.WriteObjectStart();
+				Writer.WriteValue(TEXT("name"), Model.GetString(Parameter.Name));
+				Writer.WriteValue(TEXT("type"), Model.GetString(Parameter.Type));
+				Writer.WriteValue(TEXT("description"), Model.GetString(Parameter.Description));
+				WriteStringList(Writer, Model, TEXT("flags"), Parameter.Flags);
+				Writer.WriteObjectEnd();
+			}
+			Writer.WriteArrayEnd();
+			Writer.WriteObjectEnd();
+		}
+		Writer.WriteArrayEnd();
+
+		if(Class.InheritedProperties.Num + Class.InheritedFunctions.Num + Class.InheritedNodes.Num > 0)
+		{
+			Writer.WriteObjectStart(TEXT("inherited"));
+			WriteMemberRefs(Writer, Model, TEXT("properties"), Class.InheritedProperties);
+			WriteMemberRefs(Writer, Model, TEXT("functions"), Class.InheritedFunctions);
+			WriteMemberRefs(Writer, Model, TEXT("nodes"), Class.InheritedNodes);
+			Writer.WriteObjectEnd();
+		}
+
+		if(Class.Nodes.Num() > 0)
+		{
+			Writer.WriteArrayStart(TEXT("nodes"));
+			for(int32 NodeIndex : Class.Nodes)
+			{
+				WriteNode(Writer, Model, Model.Nodes[NodeIndex]);
+			}
+			Writer.WriteArrayEnd();
+		}
+		Writer.WriteObjectEnd();
+	}
+
+	/** Column per field so each class costs a few numbers, not its whole ancestor chain. */
+	void WriteHierarchy(FDocJsonWriter& Writer, FDocModel const& Model)
+	{
+		Writer.WriteObjectStart(TEXT("hierarchy"));
+		Writer.WriteArrayStart(TEXT("names"));
+		for(FDocHierarchyEntry const& Entry : Model.Hierarchy)
+		{
+			Writer.WriteValue(Model.GetString(Entry.ClassName));
+		}
+		Writer.WriteArrayEnd();
+		Writer.WriteArrayStart(TEXT("parents"));
+		for(FDocHierarchyEntry const& Entry : Model.Hierarchy)
+		{
+			Writer.WriteValue(Entry.Parent);
+		}
+		Writer.WriteArrayEnd();
+		Writer.WriteArrayStart(TEXT("depths"));
+		for(FDocHierarchyEntry const& Entry : Model.Hierarchy)
+		{
+			Writer.WriteValue(Entry.Depth);
+		}
+		Writer.WriteArrayEnd();
+		Writer.WriteArrayStart(TEXT("docIndices"));
+		for(FDocHierarchyEntry const& Entry : Model.Hierarchy)
+		{
+			Writer.WriteValue(Entry.DocIndex);
+		}
+		Writer.WriteArrayEnd();
+		Writer.WriteArrayStart(TEXT("children"));
+		for(FDocHierarchyEntry const& Entry : Model.Hierarchy)
+		{
+			Writer.WriteArrayStart();
+			for(int32 Child : FDocModel::Slice(Model.HierarchyChildren, Entry.Children))
+			{
+				Writer.WriteValue(Child);
+			}
+			Writer.WriteArrayEnd();
+		}
+		Writer.WriteArrayEnd();
+		Writer.WriteObjectEnd();
+	}
+
+	void WriteStruct(FDocJsonWriter& Writer, FDocModel const& Model, FDocStruct const& Struct)
+	{
+		Writer.WriteObjectStart();
+		Writer.WriteValue(TEXT("structName"), Model.GetString(Struct.StructName));
+		Writer.WriteValue(TEXT("path"), Model.GetString(Struct.Path));
+		if(Struct.SuperStruct != 0)
+		{
+			Writer.WriteValue(TEXT("superStruct"), Model.GetString(Struct.SuperStruct));
+		}
+		Writer.WriteValue(TEXT("description"), Model.GetString(Struct.Description));
+		WriteProperties(Writer, Model, Struct.Properties);
+		Writer.WriteObjectEnd();
+	}
+
+	void WriteEnum(FDocJsonWriter& Writer, FDocModel const& Model, FDocEnum const& Enum)
+	{
+		Writer.WriteObjectStart();
+		Writer.WriteValue(TEXT("enumName"), Model.GetString(Enum.EnumName));
+		Writer.WriteValue(TEXT("path"), Model.GetString(Enum.Path));
+		Writer.WriteValue(TEXT("description"), Model.GetString(Enum.Description));
+		Writer.WriteArrayStart(TEXT("values"));
+		for(FDocEnumValue const& Value : FDocModel::Slice(Model.EnumValues, Enum.Values))
+		{
+			Writer.WriteObjectStart();
+			Writer.WriteValue(TEXT("name"), Model.GetString(Value.Name));
+			Writer.WriteValue(TEXT("displayName"), Model.GetString(Value.DisplayName));
+			Writer.WriteValue(TEXT("value"), Value.Value);
+			Writer.WriteValue(TEXT("description"), Model.GetString(Value.Description));
+			Writer.WriteObjectEnd();
+		}
+		Writer.WriteArrayEnd();
+		Writer.WriteObjectEnd();
+	}
+}
+
+
+FDocModel::FDocModel()
+{
+	Reset();
+}
+
+FDocStringId FDocModel::Intern(FString const& String)
+{
+	if(String.IsEmpty())
+	{
+		return 0;
+	}
+
+	const uint32 Hash = GetTypeHash(String);
+	for(auto It = StringsByHash.CreateConstKeyIterator(Hash); It; ++It)
+	{
+		if(Strings[It.Value()].Equals(String, ESearchCase::CaseSensitive))
+		{
+			return It.Value();
+		}
+	}
+
+	const FDocStringId Id = Strings.Add(String);
+	StringsByHash.Add(Hash, Id);
+	return Id;
+}
+
+FDocStringId FDocModel::FindString(FStringView String) const
+{
+	if(String.IsEmpty())
+	{
+		return 0;
+	}
+
+	for(auto It = StringsByHash.CreateConstKeyIterator(GetTypeHash(String)); It; ++It)
+	{
+		if(FStringView(Strings[It.Value()]).Equals(String, ESearchCase::CaseSensitive))
+		{
+			return It.Value();
+		}
+	}
+	return 0;
+}
+
+FDocStringId FDocModel::InternText(FString const& String, FDocTextSource const& Source)
+{
+	const FDocStringId Id = Intern(String);
+	if(Id != 0 && !Source.Text.IsEmpty() && !Source.Text.IsCultureInvariant() && !TextSources.Contains(Id))
+	{
+		TextSources.Add(Id, Source);
+	}
+	return Id;
+}
+
+FDocStringId FDocModel::InternText(FText const& Text)
+{
+	return InternText(Text.ToString(), FDocTextSource{ Text });
+}
+
+FDocRange FDocModel::AddStringList(TArrayView< const FDocStringId > List)
+{
+	FDocRange Range{ StringLists.Num(), List.Num() };
+	StringLists.Append(List.GetData(), List.Num());
+	return Range;
+}
+
+void FDocModel::SetNodeDescription(FDocNode& Node, FText const& MenuCategory)
+{
+	Node.Description = InternText(MenuCategory);
+}
+
+int32 FDocModel::AddHierarchyEntry(FDocStringId ClassName, int32 Parent)
+{
+	FDocHierarchyEntry Entry;
+	Entry.ClassName = ClassName;
+	Entry.Parent = Parent;
+	Entry.Depth = Parent != INDEX_NONE ? Hierarchy[Parent].Depth + 1 : 0;
+	return Hierarchy.Add(Entry);
+}
+
+void FDocModel::LinkHierarchy()
+{
+	// Counting pass first so each child list is a contiguous run
+	TArray< int32 > Counts;
+	Counts.SetNumZeroed(Hierarchy.Num());
+	for(FDocHierarchyEntry const& Entry : Hierarchy)
+	{
+		if(Entry.Parent != INDEX_NONE)
+		{
+			++Counts[Entry.Parent];
+		}
+	}
+
+	int32 Next = 0;
+	for(int32 Index = 0; Index < Hierarchy.Num(); ++Index)
+	{
+		Hierarchy[Index].Children = FDocRange{ Next, 0 };
+		Next += Counts[Index];
+	}
+
+	HierarchyChildren.SetNumUninitialized(Next);
+	for(int32 Index = 0; Index < Hierarchy.Num(); ++Index)
+	{
+		const int32 Parent = Hierarchy[Index].Parent;
+		if(Parent != INDEX_NONE)
+		{
+			FDocRange& Children = Hierarchy[Parent].Children;
+			HierarchyChildren[Children.First + Children.Num++] = Index;
+		}
+	}
+
+	for(FDocHierarchyEntry const& Entry : Hierarchy)
+	{
+		TArrayView< int32 > Children(HierarchyChildren.GetData() + Entry.Children.First, Entry.Children.Num);
+		Algo::Sort(Children, [this](int32 A, int32 B)
+		{
+			return GetString(Hierarchy[A].ClassName) < GetString(Hierarchy[B].ClassName);
+		});
+	}
+}
+
+void FDocModel::LinkInheritedMembers()
+{
+	InheritedRefs.Reset();
+
+	// Parents before children, their lists are what the children extend
+	TArray< int32 > Order;
+	Order.Reserve(Classes.Num());
+	for(int32 Index = 0; Index < Classes.Num(); ++Index)
+	{
+		Order.Add(Index);
+	}
+	Algo::StableSort(Order, [this](int32 A, int32 B)
+	{
+		return Hierarchy[Classes[A].HierarchyIndex].Depth < Hierarchy[Classes[B].HierarchyIndex].Depth;
+	});
+
+	TSet< FDocStringId > Hidden;
+	auto Link = [this, &Hidden](int32 ClassIndex, int32 ParentIndex, FDocRange FDocClass::* Inherited, TFunctionRef< int32(FDocClass const&) > NumOwn, TFunctionRef< FDocStringId(FDocClass const&, int32) > NameOf)
+	{
+		FDocClass const& Class = Classes[ClassIndex];
+		FDocClass const& Parent = Classes[ParentIndex];
+
+		Hidden.Reset();
+		for(int32 Idx = 0; Idx < NumOwn(Class); ++Idx)
+		{
+			Hidden.Add(NameOf(Class, Idx));
+		}
+
+		const int32 First = InheritedRefs.Num();
+		for(int32 Idx = 0; Idx < NumOwn(Parent); ++Idx)
+		{
+			bool bAlreadyHidden = false;
+			Hidden.Add(NameOf(Parent, Idx), &bAlreadyHidden);
+			if(!bAlreadyHidden)
+			{
+				InheritedRefs.Add(FDocMemberRef{ ParentIndex, Idx });
+			}
+		}
+		const FDocRange ParentInherited = Parent.*Inherited;
+		for(int32 Idx = ParentInherited.First; Idx < ParentInherited.First + ParentInherited.Num; ++Idx)
+		{
+			const FDocMemberRef Ref = InheritedRefs[Idx];
+			bool bAlreadyHidden = false;
+			Hidden.Add(NameOf(Classes[Ref.Class], Ref.Index), &bAlreadyHidden);
+			if(!bAlreadyHidden)
+			{
+				InheritedRefs.Add(Ref);
+			}
+		}
+		Classes[ClassIndex].*Inherited = FDocRange{ First, InheritedRefs.Num() - First };
+	};
+
+	for(int32 ClassIndex : Order)
+	{
+		FDocClass& Class = Classes[ClassIndex];
+		Class.InheritedProperties = FDocRange();
+		Class.InheritedFunctions = FDocRange();
+		Class.InheritedNodes = FDocRange();
+
+		// Ancestors that are not documented themselves have nothing to hand down
+		int32 ParentIndex = INDEX_NONE;
+		for(int32 Entry = Hierarchy[Class.HierarchyIndex].Parent; Entry != INDEX_NONE && ParentIndex == INDEX_NONE; Entry = Hierarchy[Entry].Parent)
+		{
+			ParentIndex = Hierarchy[Entry].DocIndex;
+		}
+		if(ParentIndex == INDEX_NONE)
+		{
+			continue;
+		}
+
+		Link(ClassIndex, ParentIndex, &FDocClass::InheritedProperties,
+			[](FDocClass const& Owner) { return Owner.Properties.Num; },
+			[this](FDocClass const& Owner, int32 Idx) { return Properties[Owner.Properties.First + Idx].Name; });
+		Link(ClassIndex, ParentIndex, &FDocClass::InheritedFunctions,
+			[](FDocClass const& Owner) { return Owner.Functions.Num; },
+			[this](FDocClass const& Owner, int32 Idx) { return Functions[Owner.Functions.First + Idx].Name; });
+		// Nodes have no member name, their doc id tells them apart; titles repeat across unrelated nodes
+		Link(ClassIndex, ParentIndex, &FDocClass::InheritedNodes,
+			[](FDocClass const& Owner) { return Owner.Nodes.Num(); },
+			[this](FDocClass const& Owner, int32 Idx) { return Nodes[Owner.Nodes[Idx]].DocsName; });
+	}
+}
+
+void FDocModel::AddTypeUsages(FString const& CppType, FDocTypeUsage const& Usage)
+{
+	TArray< FDocStringId, TInlineAllocator< 4 > > Seen;
+	int32 Idx = 0;
+	while(Idx < CppType.Len())
+	{
+		if(!(FChar::IsAlpha(CppType[Idx]) || CppType[Idx] == TEXT('_')))
+		{
+			++Idx;
+			continue;
+		}
+		const int32 Start = Idx;
+		while(Idx < CppType.Len() && (FChar::IsAlnum(CppType[Idx]) || CppType[Idx] == TEXT('_')))
+		{
+			++Idx;
+		}
+
+		const FString Name = CppType.Mid(Start, Idx - Start);
+		if(IsTypeNameSkipped(Name))
+		{
+			continue;
+		}
+		const FDocStringId Type = Intern(Name);
+		if(!Seen.Contains(Type))
+		{
+			Seen.Add(Type);
+			FDocTypeUsage& Added = TypeUsages.Add_GetRef(Usage);
+			Added.Type = Type;
+		}
+	}
+}
+
+FString FDocModel::ToNodesJson() const
+{
+	FString Output;
+	TSharedRef< FDocJsonWriter > Writer = TJsonWriterFactory< TCHAR, TCondensedJsonPrintPolicy< TCHAR > >::Create(&Output);
+
+	Writer->WriteObjectStart();
+	Writer->WriteArrayStart(TEXT("nodes"));
+	for(FDocClass const& Class : Classes)
+	{
+		WriteClass(*Writer, *this, Class);
+	}
+	Writer->WriteArrayEnd();
+	WriteHierarchy(*Writer, *this);
+
+	if(Structs.Num() > 0)
+	{
+		Writer->WriteArrayStart(TEXT("structs"));
+		for(FDocStruct const& Struct : Structs)
+		{
+			WriteStruct(*Writer, *this, Struct);
+		}
+		Writer->WriteArrayEnd();
+	}
+	if(Enums.Num() > 0)
+	{
+		Writer->WriteArrayStart(TEXT("enums"));
+		for(FDocEnum const& Enum : Enums)
+		{
+			WriteEnum(*Writer, *this, Enum);
+		}
+		Writer->WriteArrayEnd();
+	}
+	Writer->WriteObjectEnd();
+	Writer->Close();
+
+	return Output;
+}
+
+void FDocModel::Reset()
+{
+	Classes.Reset();
+	Hierarchy.Reset();
+	HierarchyChildren.Reset();
+	InheritedRefs.Reset();
+	TypeUsages.Reset();
+	Properties.Reset();
+	Functions.Reset();
+	Parameters.Reset();
+	Nodes.Reset();
+	Pins.Reset();
+	Structs.Reset();
+	Enums.Reset();
+	EnumValues.Reset();
+	StringLists.Reset();
+	TextSources.Reset();
+	Strings.Reset();
+	StringsByHash.Reset();
+
+	// Id 0 is the empty string, so zero-initialized entries read as empty
+	Strings.Add(FString());
+}
+
+bool FDocStringsView::IsValid() const
+{
+	if(Offsets.Num() == 0 || Offsets[0] != 0 || Offsets.Last() != Chars.Num())
+	{
+		return false;
+	}
+	for(int32 Idx = 1; Idx < Offsets.Num(); ++Idx)
+	{
+		if(Offsets[Idx] < Offsets[Idx - 1])
+		{
+			return false;
+		}
+	}
+	return true;
+}
+
+bool FDocModelView::IsValid() const
+{
+	if(Strings.Num() == 0 || !Strings.IsValid())
+	{
+		return false;
+	}
+
+	const int32 NumStrings = Strings.Num();
+	auto IsString = [NumStrings](FDocStringId Id) { return IsIndex(Id, NumStrings); };
+	auto IsStringList = [this](FDocRange Range) { return IsInRange(Range, StringLists.Num()); };
+
+	// Inherited refs are checked against the list of their member kind, which needs the ranges of every class to hold first
+	const bool bRecordsValid = Algo::AllOf(StringLists, IsString)
+		&& Algo::AllOf(Classes, [&](FDocClassRecord const& Class)
+		{
+			return IsString(Class.ClassName) && IsString(Class.Path) && IsIndexOrNone(Class.HierarchyIndex, Hierarchy.Num())
+				&& IsInRange(Class.Properties, Properties.Num()) && IsInRange(Class.Functions, Functions.Num()) && IsInRange(Class.Nodes, ClassNodes.Num())
+				&& IsInRange(Class.InheritedProperties, InheritedRefs.Num()) && IsInRange(Class.InheritedFunctions, InheritedRefs.Num()) && IsInRange(Class.InheritedNodes, InheritedRefs.Num());
+		})
+		&& Algo::AllOf(ClassNodes, [this](int32 Node) { return IsIndex(Node, Nodes.Num()); })
+		&& Algo::AllOf(Hierarchy, [&](FDocHierarchyEntry const& Entry)
+		{
+			return IsString(Entry.ClassName) && IsIndexOrNone(Entry.Parent, Hierarchy.Num()) && IsIndexOrNone(Entry.DocIndex, Classes.Num())
+				&& IsInRange(Entry.Children, HierarchyChildren.Num());
+		})
+		&& Algo::AllOf(HierarchyChildren, [this](int32 Child) { return IsIndex(Child, Hierarchy.Num()); })
+		&& Algo::AllOf(InheritedRefs, [this](FDocMemberRef const& Ref) { return IsIndex(Ref.Class, Classes.Num()) && Ref.Index >= 0; })
+		&& Algo::AllOf(Properties, [&](FDocProperty const& Property)
+		{
+			return IsString(Property.Name) && IsString(Property.Type) && IsString(Property.Description) && IsStringList(Property.Flags);
+		})
+		&& Algo::AllOf(Functions, [&](FDocFunction const& Function)
+		{
+			return IsString(Function.Name) && IsString(Function.Description) && IsString(Function.ReturnType) && IsString(Function.ReturnDescription)
+				&& IsStringList(Function.Flags) && IsInRange(Function.Parameters, Parameters.Num());
+		})
+		&& Algo::AllOf(Parameters, [&](FDocParameter const& Parameter)
+		{
+			return IsString(Parameter.Name) && IsString(Parameter.Type) && IsString(Parameter.Description) && IsStringList(Parameter.Flags);
+		})
+		&& Algo::AllOf(Nodes, [&](FDocNode const& Node)
+		{
+			return IsString(Node.DocsName) && IsString(Node.ClassId) && IsString(Node.ClassName) && IsString(Node.ShortTitle) && IsString(Node.FullTitle)
+				&& IsString(Node.Description) && IsString(Node.ImgPath) && IsString(Node.Function) && IsString(Node.Placeholder) && IsString(Node.ThumbPath)
+				&& IsInRange(Node.Inputs, Pins.Num()) && IsInRange(Node.Outputs, Pins.Num()) && IsStringList(Node.UnavailableIn);
+		})
+		&& Algo::AllOf(Pins, [&](FDocPin const& Pin)
+		{
+			return IsString(Pin.Name) && IsString(Pin.Type) && IsString(Pin.Description) && IsStringList(Pin.Contexts);
+		})
+		&& Algo::AllOf(Structs, [&](FDocStruct const& Struct)
+		{
+			return IsString(Struct.StructName) && IsString(Struct.Path) && IsString(Struct.SuperStruct) && IsString(Struct.Description)
+				&& IsInRange(Struct.Properties, Properties.Num());
+		})
+		&& Algo::AllOf(Enums, [&](FDocEnum const& Enum)
+		{
+			return IsString(Enum.EnumName) && IsString(Enum.Path) && IsString(Enum.Description) && IsInRange(Enum.Values, EnumValues.Num());
+		})
+		&& Algo::AllOf(EnumValues, [&](FDocEnumValue const& Value)
+		{
+			return IsString(Value.Name) && IsString(Value.DisplayName) && IsString(Value.Description);
+		});
+
+	if(!bRecordsValid)
+	{
+		return false;
+	}
+
+	auto AreRefsValid = [this](FDocRange Range, TFunctionRef< int32(FDocClassRecord const&) > NumMembers)
+	{
+		return Algo::AllOf(Slice(InheritedRefs, Range), [this, &NumMembers](FDocMemberRef const& Ref) { return Ref.Index < NumMembers(Classes[Ref.Class]); });
+	};
+	return Algo::AllOf(Classes, [&](FDocClassRecord const& Class)
+		{
+			return AreRefsValid(Class.InheritedProperties, [](FDocClassRecord const& Owner) { return Owner.Properties.Num; })
+				&& AreRefsValid(Class.InheritedFunctions, [](FDocClassRecord const& Owner) { return Owner.Functions.Num; })
+				&& AreRefsValid(Class.InheritedNodes, [](FDocClassRecord const& Owner) { return Owner.Nodes.Num; });
+		})
+		&& Algo::AllOf(TypeUsages, [&](FDocTypeUsage const& Usage)
+		{
+			if(!IsString(Usage.Type))
+			{
+				return false;
+			}
+			switch(Usage.Role)
+			{
+			case EDocTypeRole::StructMember:
+				return IsIndex(Usage.Owner, Structs.Num()) && IsIndex(Usage.Member, Structs[Usage.Owner].Properties.Num);
+			case EDocTypeRole::Property:
+				return IsIndex(Usage.Owner, Classes.Num()) && IsIndex(Usage.Member, Classes[Usage.Owner].Properties.Num);
+			case EDocTypeRole::Return:
+				return IsIndex(Usage.Owner, Classes.Num()) && IsIndex(Usage.Member, Classes[Usage.Owner].Functions.Num);
+			case EDocTypeRole::Parameter:
+				return IsIndex(Usage.Owner, Classes.Num()) && IsIndex(Usage.Member, Classes[Usage.Owner].Functions.Num)
+					&& IsIndex(Usage.Parameter, Functions[Classes[Usage.Owner].Functions.First + Usage.Member].Parameters.Num);
+			}
+			return false;
+		});
+}
+
+bool FDocModelView::IsValid(FDocSearchEntry const& Entry) const
+{
+	if(!IsIndex(Entry.Label, Strings.Num()))
+	{
+		return false;
+	}
+	switch(Entry.Kind)
+	{
+	case EDocEntryKind::Struct:
+		return IsIndex(Entry.Owner, Structs.Num()) && Entry.Member == INDEX_NONE;
+	case EDocEntryKind::Enum:
+		return IsIndex(Entry.Owner, Enums.Num()) && Entry.Member == INDEX_NONE;
+	case EDocEntryKind::Class:
+		return IsIndex(Entry.Owner, Classes.Num()) && Entry.Member == INDEX_NONE;
+	case EDocEntryKind::Property:
+		return IsIndex(Entry.Owner, Classes.Num()) && IsIndex(Entry.Member, Classes[Entry.Owner].Properties.Num);
+	case EDocEntryKind::Function:
+		return IsIndex(Entry.Owner, Classes.Num()) && IsIndex(Entry.Member, Classes[Entry.Owner].Functions.Num);
+	case EDocEntryKind::Node:
+		return IsIndex(Entry.Owner, Classes.Num()) && IsIndex(Entry.Member, Classes[Entry.Owner].Nodes.Num);
+	}
+	return false;
+}
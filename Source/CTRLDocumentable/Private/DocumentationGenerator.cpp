@@ -20,6 +20,7 @@
 #include "K2Node_ComponentBoundEvent.h"
 #include "K2Node_DynamicCast.h"
 #include "K2Node_Message.h"
+#include "K2Node_CallFunction.h"
 #include "XmlFile.h"
 #include "Slate/WidgetRenderer.h"
 #include "Engine/TextureRenderTarget2D.h"
@@ -28,46 +29,309 @@
 #include "Interfaces/IPluginManager.h"
 #include "Stats/StatsMisc.h"
 #include "Runtime/ImageWriteQueue/Public/ImageWriteTask.h"
+#include "Rendering/NodeImageKernels.h"
+#include "Rendering/NodeImageRenderer.h"
+#include "Rendering/SvgNodeRenderer.h"
+#include "Rendering/NodeImageIO.h"
+#include "Rendering/NodeSpriteSheets.h"
+#include "Server/NodeImageServer.h"
+#include "DocumentModel.h"
+#include "Docs/DocComment.h"
+#include "Docs/FieldTextCache.h"
+#include "Docs/PinDocExtractor.h"
+#include "Misc/FileHelper.h"
+#include "Misc/Parse.h"
+#include "HAL/PlatformProcess.h"
+#include "HAL/FileManager.h"
+#include "Async/Async.h"
+
+FDocumentationGenerator::FDocumentationGenerator()
+{
+	FieldTexts = MakeUnique< FFieldTextCache >();
+	DocComments = MakeUnique< FDocCommentCache >(*FieldTexts);
+	PinDocs = MakeUnique< FPinDocExtractor >(*DocComments, *FieldTexts);
+}
 
 FDocumentationGenerator::~FDocumentationGenerator()
 {
 	CleanUp();
 }
 
-bool FDocumentationGenerator::GT_Init(FString const& InDocsTitle, FString const& InOutputDir, UClass* BlueprintContextClass)
+bool FDocumentationGenerator::GT_Init(FGenerationSettings const& InSettings, FString const& InOutputDir)
 {
-	DummyBP = CastChecked< UBlueprint >(FKismetEditorUtilities::CreateBlueprint(
-		BlueprintContextClass,
-		::GetTransientPackage(),
-		NAME_None,
-		EBlueprintType::BPTYPE_Normal,
-		UBlueprint::StaticClass(),
-		UBlueprintGeneratedClass::StaticClass(),
-		NAME_None
-	));
-	if(!DummyBP.IsValid())
+	Settings = InSettings;
+
+	// The blueprint, graph and panel are kept from earlier runs with the same context class
+	UClass* const MainContextClass = Settings.BlueprintContextClass.Get();
+	if(!GT_AcquireGraphContext(MainContextClass))
 	{
 		return false;
 	}
 
-	Graph = FBlueprintEditorUtils::CreateNewGraph(DummyBP.Get(), TEXT("TempoGraph"), UEdGraph::StaticClass(), UEdGraphSchema_K2::StaticClass());
+	OtherContexts.Reset();
+	for(auto const& ContextClass : Settings.AdditionalContextClasses)
+	{
+		UClass* const Class = ContextClass.Get();
+		if(!Class || Class == MainContextClass || OtherContexts.ContainsByPredicate([Class](auto const& Entry) { return Entry.Key == Class; }))
+		{
+			continue;
+		}
+		if(!GT_AcquireGraphContext(Class))
+		{
+			UE_LOG(LogCTRLDocumentable, Warning, TEXT("Failed to create a blueprint for context class %s, skipped."), *Class->GetName());
+			continue;
+		}
+		OtherContexts.Emplace(Class, GraphContexts[Class].Graph);
+	}
+
+	FGraphContext const& MainContext = GraphContexts[MainContextClass];
+	DummyBP = MainContext.DummyBP;
+	Graph = MainContext.Graph;
+	GraphPanel = MainContext.GraphPanel;
+	GT_ResetGraph();
+
+	// Vector images are drawn without Slate or the RHI, so there's nothing to set up for them
+	if(Settings.NodeImageFormat == ENodeImageFormat::Raster)
+	{
+		const FVector2D DrawSize(1024.0f, 1024.0f);
+		const FIntPoint AtlasSize(Settings.NodeAtlasSize, Settings.NodeAtlasSize);
+
+		// Render targets and readbacks stay pooled unless their configuration changed
+		if(!ImageRenderer.IsValid() || RendererAtlasSize != AtlasSize || RendererMaxInFlight != Settings.MaxNodeImagesInFlight)
+		{
+			if(ImageRenderer.IsValid())
+			{
+				ImageRenderer->GT_Release();
+			}
+			ImageRenderer = MakeUnique< FNodeImageRenderer >(DrawSize, AtlasSize, Settings.MaxNodeImagesInFlight);
+			RendererAtlasSize = AtlasSize;
+			RendererMaxInFlight = Settings.MaxNodeImagesInFlight;
+		}
 
-	DummyBP->AddToRoot();
-	Graph->AddToRoot();
+		SpriteSheets.Reset();
+		if(Settings.bPackNodeSpriteSheets)
+		{
+			SpriteSheets = MakeUnique< FNodeSpriteSheetBuilder >(AtlasSize, Settings.NodeImageEncoder);
+		}
+	}
+	else
+	{
+		SpriteSheets.Reset();
+	}
 
-	GraphPanel = SNew(SGraphPanel)
-		.GraphObj(Graph.Get())
-		;
-	// We want full detail for rendering, passing a super-high zoom value will guarantee the highest LOD.
-	GraphPanel->RestoreViewSettings(FVector2D(0, 0), 10.0f);
+	// Per run state
+	ImageServer.Reset();
+	PendingBatch.Reset();
+	PendingImageNodes.Reset();
+	{
+		FScopeLock ScopeLock(&ImageResultsLock);
+		ImageResults.Reset();
+	}
+	NumNodeImagesWritten = 0;
+	GenerateNodeImageTime = 0.0;
+	GenerateNodeDocsTime = 0.0;
+	GenerateFuncDocsTime = 0.0;
 
-	DocsTitle = InDocsTitle;
+	DocsTitle = Settings.DocumentationTitle;
 	
 	OutputDir = InOutputDir;
 
 	return true;
 }
 
+bool FDocumentationGenerator::GT_AcquireGraphContext(UClass* ContextClass)
+{
+	FGraphContext* Context = GraphContexts.Find(ContextClass);
+
+	// A recompiled blueprint context class is replaced by a new class object, the old dummy is of no use anymore
+	if(Context && (!Context->DummyBP.IsValid() || !Context->Graph.IsValid() || ContextClass->HasAnyClassFlags(CLASS_NewerVersionExists)))
+	{
+		GT_ReleaseGraphContext(*Context);
+		GraphContexts.Remove(ContextClass);
+		Context = nullptr;
+	}
+
+	if(!Context)
+	{
+		FGraphContext NewContext;
+		NewContext.DummyBP = CastChecked< UBlueprint >(FKismetEditorUtilities::CreateBlueprint(
+			ContextClass,
+			::GetTransientPackage(),
+			NAME_None,
+			EBlueprintType::BPTYPE_Normal,
+			UBlueprint::StaticClass(),
+			UBlueprintGeneratedClass::StaticClass(),
+			NAME_None
+		));
+		if(!NewContext.DummyBP.IsValid())
+		{
+			return false;
+		}
+
+		NewContext.Graph = FBlueprintEditorUtils::CreateNewGraph(NewContext.DummyBP.Get(), TEXT("TempoGraph"), UEdGraph::StaticClass(), UEdGraphSchema_K2::StaticClass());
+
+		NewContext.DummyBP->AddToRoot();
+		NewContext.Graph->AddToRoot();
+
+		NewContext.GraphPanel = SNew(SGraphPanel)
+			.GraphObj(NewContext.Graph.Get())
+			;
+		// We want full detail for rendering, passing a super-high zoom value will guarantee the highest LOD.
+		NewContext.GraphPanel->RestoreViewSettings(FVector2D(0, 0), 10.0f);
+
+		GraphContexts.Add(ContextClass, MoveTemp(NewContext));
+	}
+
+	return true;
+}
+
+void FDocumentationGenerator::GT_ResetGraph()
+{
+	// Nodes spawned by the previous run were rooted for its duration, in every context
+	for(auto& Entry : GraphContexts)
+	{
+		UEdGraph* ContextGraph = Entry.Value.Graph.Get();
+		if(!ContextGraph)
+		{
+			continue;
+		}
+
+		TArray< UEdGraphNode* > Nodes = ContextGraph->Nodes;
+		for(auto Node : Nodes)
+		{
+			if(Node)
+			{
+				Node->RemoveFromRoot();
+				ContextGraph->RemoveNode(Node);
+			}
+		}
+	}
+}
+
+void FDocumentationGenerator::GT_SpawnContextVariants(UBlueprintNodeSpawner* Spawner, UK2Node* Node, FNodeProcessingState& State)
+{
+	const bool bSensitive = IsContextSensitive(Node);
+	for(auto const& Context : OtherContexts)
+	{
+		UEdGraph* ContextGraph = Context.Value.Get();
+		if(!ContextGraph)
+		{
+			continue;
+		}
+
+		// Availability is answered by the node already spawned, only nodes whose pins may change are spawned again
+		if(!Node->IsCompatibleWithGraph(ContextGraph))
+		{
+			State.ContextVariants.Add({ Context.Key, nullptr });
+			continue;
+		}
+		if(!bSensitive)
+		{
+			continue;
+		}
+
+		UK2Node* Variant = Cast< UK2Node >(Spawner->Invoke(ContextGraph, TSet< FBindingObject >(), FVector2D(0, 0)));
+		if(Variant == nullptr)
+		{
+			State.ContextVariants.Add({ Context.Key, nullptr });
+			continue;
+		}
+		if(HasSamePins(Node, Variant))
+		{
+			ContextGraph->RemoveNode(Variant);
+			continue;
+		}
+
+		// Read by GenerateNodeDocs on the processor thread, kept like the main node until the next run
+		Variant->AddToRoot();
+		State.ContextVariants.Add({ Context.Key, Variant });
+	}
+}
+
+bool FDocumentationGenerator::IsContextSensitive(UK2Node* Node)
+{
+	// World context and self defaulted pins are hidden or shown depending on the blueprint class
+	if(auto CallNode = Cast< UK2Node_CallFunction >(Node))
+	{
+		if(const UFunction* Function = CallNode->GetTargetFunction())
+		{
+			static const FName NAME_WorldContext(TEXT("WorldContext"));
+			static const FName NAME_DefaultToSelf(TEXT("DefaultToSelf"));
+			return Function->HasMetaData(NAME_WorldContext) || Function->HasMetaData(NAME_DefaultToSelf);
+		}
+	}
+	return false;
+}
+
+bool FDocumentationGenerator::HasSamePins(UK2Node* A, UK2Node* B)
+{
+	auto VisiblePins = [](UK2Node* Node)
+	{
+		TArray< UEdGraphPin*, TInlineAllocator< 16 > > Pins;
+		for(auto Pin : Node->Pins)
+		{
+			if(!Pin->bHidden)
+			{
+				Pins.Add(Pin);
+			}
+		}
+		return Pins;
+	};
+
+	const auto PinsA = VisiblePins(A);
+	const auto PinsB = VisiblePins(B);
+	if(PinsA.Num() != PinsB.Num())
+	{
+		return false;
+	}
+	for(int32 Idx = 0; Idx < PinsA.Num(); ++Idx)
+	{
+		if(PinsA[Idx]->PinName != PinsB[Idx]->PinName || PinsA[Idx]->Direction != PinsB[Idx]->Direction || PinsA[Idx]->PinType != PinsB[Idx]->PinType)
+		{
+			return false;
+		}
+	}
+	return true;
+}
+
+void FDocumentationGenerator::GT_ReleaseGraphContext(FGraphContext& Context)
+{
+	Context.GraphPanel.Reset();
+
+	if(Context.DummyBP.IsValid())
+	{
+		Context.DummyBP->RemoveFromRoot();
+	}
+	if(Context.Graph.IsValid())
+	{
+		for(auto Node : Context.Graph->Nodes)
+		{
+			if(Node)
+			{
+				Node->RemoveFromRoot();
+			}
+		}
+		Context.Graph->RemoveFromRoot();
+	}
+}
+
+void FDocumentationGenerator::GT_Invalidate()
+{
+	for(auto& Entry : GraphContexts)
+	{
+		GT_ReleaseGraphContext(Entry.Value);
+	}
+	GraphContexts.Empty();
+
+	DummyBP.Reset();
+	Graph.Reset();
+	GraphPanel.Reset();
+	OtherContexts.Reset();
+
+	ResetTextCaches();
+	PinDocs->Reset();
+}
+
 UK2Node* FDocumentationGenerator::GT_InitializeForSpawner(UBlueprintNodeSpawner* Spawner, UObject* SourceObject, FNodeProcessingState& OutState)
 {
 	if(!IsSpawnerDocumentable(Spawner, SourceObject->IsA< UBlueprint >()))
@@ -94,6 +358,13 @@ UK2Node* FDocumentationGenerator::GT_InitializeForSpawner(UBlueprintNodeSpawner*
 	
 	OutState = FNodeProcessingState();
 	OutState.AssociatedClass = AssociatedClass;
+	OutState.Spawner = Spawner;
+	OutState.SourceObject = SourceObject;
+
+	if(OtherContexts.Num() > 0)
+	{
+		GT_SpawnContextVariants(Spawner, K2NodeInst, OutState);
+	}
 	return K2NodeInst;
 }
 
@@ -102,42 +373,86 @@ bool FDocumentationGenerator::GT_Finalize(FString OutputPath)
 	return true;
 }
 
-/**
- * Multiply each pixel alpha by the input alpha.
- */
-struct TAsyncAlphaMultiplier
+bool FDocumentationGenerator::GT_RenderNodeImage(UBlueprintNodeSpawner* Spawner, UObject* SourceObject, FString const& Filename, TUniqueFunction< void(TArray< uint8 >&&) >&& OnDone)
 {
-	float AlphaMulti;
-	TAsyncAlphaMultiplier(float InAlphaMulti) : AlphaMulti(InAlphaMulti) {}
+	if(!ImageRenderer.IsValid())
+	{
+		return false;
+	}
 
-	void operator()(FImagePixelData* PixelData)
+	FNodeProcessingState State;
+	UK2Node* Node = GT_InitializeForSpawner(Spawner, SourceObject, State);
+	if(Node == nullptr)
 	{
-		check(PixelData->GetType() == EImagePixelType::Float32);
+		return false;
+	}
+
+	AdjustNodeForSnapshot(Node);
+
+	auto NodeWidget = FNodeFactory::CreateNodeWidget(Node);
+	NodeWidget->SetOwner(GraphPanel.ToSharedRef());
 
-		TImagePixelData<FLinearColor>* LinearColorData = static_cast<TImagePixelData<FLinearColor>*>(PixelData);
-		for (FLinearColor& Pixel : LinearColorData->Pixels)
+	// The readback lands in GT_PumpNodeImages, so this runs on the game thread and may touch the graph
+	TWeakObjectPtr< UEdGraph > WeakGraph = Graph;
+	TWeakObjectPtr< UK2Node > WeakNode = Node;
+	return ImageRenderer->GT_Submit(NodeWidget.ToSharedRef(), [WeakGraph, WeakNode, Filename, Encoder = Settings.NodeImageEncoder, OnDone = MoveTemp(OnDone)](TArray64< FColor >&& Pixels, FIntPoint Size) mutable
+	{
+		if(WeakGraph.IsValid() && WeakNode.IsValid())
 		{
-			Pixel.A = FMath::Min(1.f, Pixel.A * AlphaMulti);
+			WeakGraph->RemoveNode(WeakNode.Get());
 		}
-	}
-};
 
-void FDocumentationGenerator::CleanUp()
+		AsyncTask(ENamedThreads::AnyBackgroundThreadNormalTask, [Pixels = MoveTemp(Pixels), Size, Filename, Encoder, OnDone = MoveTemp(OnDone)]() mutable
+		{
+			TArray< uint8 > Png;
+			if(TrimNodeImage(Pixels, Size))
+			{
+				IFileManager::Get().MakeDirectory(*FPaths::GetPath(Filename), true);
+				if(CTRLDocumentable::NodeImage::SavePng(MoveTemp(Pixels), Size, Filename, Encoder))
+				{
+					FFileHelper::LoadFileToArray(Png, *Filename);
+				}
+			}
+			OnDone(MoveTemp(Png));
+		});
+	});
+}
+
+bool FDocumentationGenerator::GT_HasFreeImageSlot() const
+{
+	return ImageRenderer.IsValid() && ImageRenderer->HasFreeSlot();
+}
+
+void FDocumentationGenerator::GT_PumpNodeImages()
 {
-	if(GraphPanel.IsValid())
+	if(ImageRenderer.IsValid())
 	{
-		GraphPanel.Reset();
+		ImageRenderer->GT_Poll();
+		ImageRenderer->DispatchCompleted();
 	}
+}
 
-	if(DummyBP.IsValid())
+void FDocumentationGenerator::SetNodeImageServer(TSharedPtr< FNodeImageServer > InServer)
+{
+	ImageServer = InServer;
+}
+
+void FDocumentationGenerator::CleanUp()
+{
+	// A finishing task has flushed its images already, anything still pending here belongs to a cancelled one
+	DiscardNodeImages();
+
+	auto ReleaseGraphs = [this]
+	{
+		GT_Invalidate();
+	};
+	if(IsInGameThread())
 	{
-		DummyBP->RemoveFromRoot();
-		DummyBP.Reset();
+		ReleaseGraphs();
 	}
-	if(Graph.IsValid())
+	else
 	{
-		Graph->RemoveFromRoot();
-		Graph.Reset();
+		CTRLDocumentable::RunOnGameThread(ReleaseGraphs);
 	}
 }
 
@@ -190,163 +505,463 @@ static FORCEINLINE void CreateDirectoryRecursively(FString FolderToMake)
 	}
 }
 
+void FDocumentationGenerator::PlanNodeImage(UEdGraphNode* Node, FNodeProcessingState& State)
+{
+	if(!State.ImageAbsolutePath.IsEmpty())
+	{
+		return;
+	}
+
+	FString NodeName = GetNodeDocId(Node);
+
+	const FString ClassNamePath = State.AssociatedClass->GetName() + "/";
+
+	const FString ImageBasePath = GetImageRootDir() / ClassNamePath;
+
+	
+	if (!FPaths::DirectoryExists(ImageBasePath))
+	{
+		CreateDirectoryRecursively(ImageBasePath);
+	}
+	
+	const bool bVector = Settings.NodeImageFormat == ENodeImageFormat::Vector;
+	FString ImgFilename = FString::Printf(TEXT("nd_img_%s.%s"), *NodeName, bVector ? TEXT("svg") : TEXT("png"));
+	ImgFilename = FPaths::MakeValidFileName(ImgFilename, '_');
+
+	State.RelImageBasePath = "../img/" + ClassNamePath;
+	State.ImageFilename = ImgFilename;
+	State.ImageAbsolutePath = ImageBasePath / ImgFilename;
+	State.bImageDeferred = ImageServer.IsValid() && !bVector;
+}
+
 bool FDocumentationGenerator::GenerateNodeImage(UEdGraphNode* Node, FNodeProcessingState& State)
 {
 	SCOPE_SECONDS_COUNTER(GenerateNodeImageTime);
 
-	const FVector2D DrawSize(1024.0f, 1024.0f);
+	AdjustNodeForSnapshot(Node);
 
-	bool bSuccess = false;
+	PlanNodeImage(Node, State);
 
-	AdjustNodeForSnapshot(Node);
+	const FString NodeName = GetNodeDocId(Node);
+	const FString ScreenshotSaveName = State.ImageAbsolutePath;
+	const bool bVector = Settings.NodeImageFormat == ENodeImageFormat::Vector;
 
-	FString NodeName = GetNodeDocId(Node);
+	if(State.bImageDeferred)
+	{
+		// Drawn by the server the first time the viewer asks for it. Whatever an earlier run left here may be stale.
+		IFileManager::Get().Delete(*ScreenshotSaveName, false, true, true);
+		ImageServer->Register(State.AssociatedClass->GetName() / State.ImageFilename, State.Spawner, State.SourceObject);
+		return true;
+	}
 
-	FIntRect Rect;
-	
-	TUniquePtr<TImagePixelData<FLinearColor>> PixelData;
+	if(bVector)
+	{
+		// Capture what's needed here and draw on a worker, the game thread is never involved
+		PendingImageWrites.Add(FFunctionGraphTask::CreateAndDispatchWhenReady(
+			[this, Desc = CTRLDocumentable::NodeSvg::DescribeNode(Node), ScreenshotSaveName, NodeName]
+			{
+				FNodeImageResult Result;
+				const FString Svg = CTRLDocumentable::NodeSvg::RenderNode(Desc, &Result.Size);
+				if(!FFileHelper::SaveStringToFile(Svg, *ScreenshotSaveName, FFileHelper::EEncodingOptions::ForceUTF8WithoutBOM))
+				{
+					UE_LOG(LogCTRLDocumentable, Warning, TEXT("Failed to save vector image for node: %s"), *NodeName);
+					return;
+				}
+				++NumNodeImagesWritten;
+
+				FScopeLock ScopeLock(&ImageResultsLock);
+				ImageResults.Add(ScreenshotSaveName, MoveTemp(Result));
+			},
+			TStatId(), nullptr, ENamedThreads::AnyBackgroundThreadNormalTask));
+		return true;
+	}
+
+	if(Settings.bBatchNodeImages)
+	{
+		// Drawn later together with the rest of the batch, see SubmitNodeImageBatch
+		PendingBatch.Add(FBatchedNodeImage{ Node, NodeName, ScreenshotSaveName });
+		return true;
+	}
 
-	bSuccess = CTRLDocumentable::RunOnGameThreadRetVal([this, Node, DrawSize, &Rect, &PixelData]
+	// The pixels come back over the next few frames; encoding and writing happens on a background task from there.
+	auto OnReadback = [this, ScreenshotSaveName, NodeName](TArray64< FColor >&& Pixels, FIntPoint Size)
+	{
+		QueueNodeImageWrite(MoveTemp(Pixels), Size, ScreenshotSaveName, NodeName);
+	};
+
+	const bool bSubmitted = CTRLDocumentable::RunOnGameThreadRetVal([this, Node, &OnReadback]
 	{
 		auto NodeWidget = FNodeFactory::CreateNodeWidget(Node);
 		NodeWidget->SetOwner(GraphPanel.ToSharedRef());
 
-		const bool bUseGammaCorrection = true;
-		FWidgetRenderer Renderer(bUseGammaCorrection);
-		Renderer.SetIsPrepassNeeded(true);
-		auto RenderTarget = Renderer.DrawWidget(NodeWidget.ToSharedRef(), DrawSize);
-		
-		const FVector2D DesiredDouble = NodeWidget->GetDesiredSize();
-		const FIntPoint DesiredInt(DesiredDouble.X, DesiredDouble.Y);
+		return ImageRenderer->GT_Submit(NodeWidget.ToSharedRef(), MoveTemp(OnReadback));
+	});
 
-		auto Desired = NodeWidget->GetDesiredSize();
-	
-		FTextureRenderTargetResource* RTResource = RenderTarget->GameThread_GetRenderTargetResource();
-		Rect = FIntRect(0, 0, DesiredInt.X, DesiredInt.Y);
-		//Rect = FIntRect(0, 0, (int32)Desired.X, (int32)Desired.Y);
-		FReadSurfaceDataFlags ReadPixelFlags(RCM_UNorm);
-		ReadPixelFlags.SetLinearToGamma(false); // @TODO: is this gamma correction, or something else?
-
-		PixelData = MakeUnique<TImagePixelData<FLinearColor>>(DesiredInt);
-		PixelData->Pixels.SetNumUninitialized(DesiredInt.X * DesiredInt.Y);
-		
-		TArray<FColor> Pixels;
+	if(!bSubmitted)
+	{
+		UE_LOG(LogCTRLDocumentable, Warning, TEXT("Failed to queue node image render for node: %s"), *NodeName);
+		return false;
+	}
 
-		if (RTResource->ReadLinearColorPixelsPtr(PixelData->Pixels.GetData(), ReadPixelFlags, Rect) == false)
+	return true;
+}
+
+void FDocumentationGenerator::SubmitNodeImageBatch()
+{
+	while(PendingBatch.Num() > 0)
+	{
+		WaitForNodeImageSlot();
+
+		TArray< FIntRect > Rects;
+		const int32 Placed = CTRLDocumentable::RunOnGameThreadRetVal([this, &Rects]
 		{
-			UE_LOG(LogCTRLDocumentable, Warning, TEXT("Failed to read pixels for node image."));
-			return false;
+			TArray< TSharedRef< SWidget > > Widgets;
+			Widgets.Reserve(PendingBatch.Num());
+			for(auto const& Entry : PendingBatch)
+			{
+				auto NodeWidget = FNodeFactory::CreateNodeWidget(Entry.Node);
+				NodeWidget->SetOwner(GraphPanel.ToSharedRef());
+				Widgets.Add(NodeWidget.ToSharedRef());
+			}
+
+			TArray< FBatchedNodeImage > Batch = PendingBatch;
+			return ImageRenderer->GT_SubmitAtlas(Widgets, Rects, [this, Batch = MoveTemp(Batch)](TArray64< FColor >&& Pixels, FIntPoint Size, TArray< FIntRect > const& AtlasRects)
+			{
+				// Slice the atlas back into one image per node
+				for(int32 Idx = 0; Idx < Batch.Num(); ++Idx)
+				{
+					FIntRect Rect = AtlasRects[Idx];
+					Rect.Clip(FIntRect(FIntPoint::ZeroValue, Size));
+					if(Rect.Area() <= 0)
+					{
+						continue;
+					}
+
+					TArray64< FColor > NodePixels;
+					CTRLDocumentable::NodeImage::CropPixels(Pixels.GetData(), Size, Rect, NodePixels);
+					QueueNodeImageWrite(MoveTemp(NodePixels), Rect.Size(), Batch[Idx].Filename, Batch[Idx].NodeName);
+				}
+			});
+		});
+
+		if(Placed == 0)
+		{
+			// Larger than the atlas (or nothing could be queued), fall back to drawing the first node on its own
+			FBatchedNodeImage Entry = PendingBatch[0];
+			PendingBatch.RemoveAt(0);
+
+			const bool bSubmitted = CTRLDocumentable::RunOnGameThreadRetVal([this, &Entry]
+			{
+				auto NodeWidget = FNodeFactory::CreateNodeWidget(Entry.Node);
+				NodeWidget->SetOwner(GraphPanel.ToSharedRef());
+
+				return ImageRenderer->GT_Submit(NodeWidget.ToSharedRef(), [this, Entry](TArray64< FColor >&& Pixels, FIntPoint Size)
+				{
+					QueueNodeImageWrite(MoveTemp(Pixels), Size, Entry.Filename, Entry.NodeName);
+				});
+			});
+
+			if(!bSubmitted)
+			{
+				UE_LOG(LogCTRLDocumentable, Warning, TEXT("Failed to queue node image render for node: %s"), *Entry.NodeName);
+			}
+			continue;
 		}
 
-		return true;
-	});
+		// Keep whatever didn't fit for the next atlas
+		for(int32 Idx = PendingBatch.Num() - 1; Idx >= 0; --Idx)
+		{
+			if(Rects.IsValidIndex(Idx) && Rects[Idx].Area() > 0)
+			{
+				PendingBatch.RemoveAt(Idx);
+			}
+		}
+	}
+}
 
-	if(!bSuccess)
+void FDocumentationGenerator::WaitForNodeImageSlot()
+{
+	while(ImageRenderer.IsValid() && !ImageRenderer->HasFreeSlot())
 	{
-		return false;
+		PumpNodeImageReadbacks();
 	}
+}
 
-	const FString ClassNamePath = State.AssociatedClass->GetName() + "/";
-
-	const FString ImageBasePath = FPaths::Combine(IPluginManager::Get().FindPlugin("CTRLDocumentable")->GetBaseDir() + "/web/public/") / TEXT("img/") / ClassNamePath;
+void FDocumentationGenerator::FlushNodeImages()
+{
+	SubmitNodeImageBatch();
 
-	
-	if (!FPaths::DirectoryExists(ImageBasePath))
+	while(ImageRenderer.IsValid() && ImageRenderer->NumInFlight() > 0)
 	{
-		CreateDirectoryRecursively(ImageBasePath);
-	}
-	State.RelImageBasePath = "../img/" + ClassNamePath;
-	
-	FString ImgFilename = FString::Printf(TEXT("nd_img_%s.png"), *NodeName);
-	ImgFilename = FPaths::MakeValidFileName(ImgFilename, '_');
-	FString ScreenshotSaveName = ImageBasePath / ImgFilename;
-	TUniquePtr<FImageWriteTask> ImageTask = MakeUnique<FImageWriteTask>();
-	ImageTask->PixelData = MoveTemp(PixelData);
-	ImageTask->Filename = ScreenshotSaveName;
-	ImageTask->Format = EImageFormat::PNG;
-	ImageTask->CompressionQuality = (int32)EImageCompressionQuality::Default;
-	ImageTask->bOverwriteFile = true;
-	//ImageTask->PixelPreProcessors.Add(TAsyncAlphaWrite<FLinearColor>(255));
-	ImageTask->PixelPreProcessors.Add(TAsyncAlphaMultiplier(2.f));
-	if(ImageTask->RunTask())
-	{
-		// Success!
-		bSuccess = true;
-		State.ImageFilename = ImgFilename;
+		PumpNodeImageReadbacks();
 	}
-	else
+
+	FTaskGraphInterface::Get().WaitUntilTasksComplete(PendingImageWrites);
+	PendingImageWrites.Reset();
+}
+
+void FDocumentationGenerator::DiscardNodeImages()
+{
+	PendingBatch.Reset();
+
+	// Releasing the renderer drops its readbacks unread, the next task pools fresh targets
+	if(ImageRenderer.IsValid())
 	{
-		UE_LOG(LogCTRLDocumentable, Warning, TEXT("Failed to save screenshot image for node: %s"), *NodeName);
+		auto ReleaseRenderer = [this]
+		{
+			ImageRenderer->GT_Release();
+		};
+		if(IsInGameThread())
+		{
+			ReleaseRenderer();
+		}
+		else
+		{
+			CTRLDocumentable::RunOnGameThread(ReleaseRenderer);
+		}
+		ImageRenderer.Reset();
 	}
 
-	return bSuccess;
+	// Encodes already running reference this generator, they can only be waited out
+	FTaskGraphInterface::Get().WaitUntilTasksComplete(PendingImageWrites);
+	PendingImageWrites.Reset();
+	SpriteSheets.Reset();
 }
 
-inline FString WrapAsCDATA(FString const& InString)
+void FDocumentationGenerator::PumpNodeImageReadbacks()
 {
-	return TEXT("<![CDATA[") + InString + TEXT("]]>");
+	// The renderer polls from the game thread's own tick and signals as copies land, waiting here on the game thread
+	// would stall the very tick that completes them. Game thread code pumps through GT_PumpNodeImages instead.
+	check(!IsInGameThread());
+
+	// The timeout only bounds how long a stalled GPU can hold the loop before its state is checked again
+	ImageRenderer->WaitForReadback(100);
+	ImageRenderer->DispatchCompleted();
 }
 
-inline FXmlNode* AppendChild(FXmlNode* Parent, FString const& Name)
+void FDocumentationGenerator::QueueNodeImageWrite(TArray64< FColor >&& Pixels, FIntPoint Size, FString const& Filename, FString const& NodeName)
 {
-	Parent->AppendChildNode(Name, FString());
-	return Parent->GetChildrenNodes().Last();
+	PendingImageWrites.Add(FFunctionGraphTask::CreateAndDispatchWhenReady(
+		[this, Pixels = MoveTemp(Pixels), Size, Filename, NodeName, Encoder = Settings.NodeImageEncoder]() mutable
+		{
+			if(!TrimNodeImage(Pixels, Size))
+			{
+				UE_LOG(LogCTRLDocumentable, Warning, TEXT("Node image is fully transparent: %s"), *NodeName);
+				return;
+			}
+
+			FNodeImageResult Result;
+			Result.Size = Size;
+			if(Settings.bEmbedImagePlaceholders)
+			{
+				Result.Placeholder = CTRLDocumentable::NodeImage::MakePlaceholderDataUri(Pixels.GetData(), Size, 16);
+			}
+			// Sprite sheets already cut list pages down to one request per class, thumbnails are for single images
+			if(Settings.NodeThumbnailWidth > 0 && Size.X > Settings.NodeThumbnailWidth && !SpriteSheets.IsValid())
+			{
+				const FIntPoint ThumbSize(Settings.NodeThumbnailWidth, FMath::Max(1, (int32)((int64)Size.Y * Settings.NodeThumbnailWidth / Size.X)));
+				TArray64< FColor > Thumb;
+				CTRLDocumentable::NodeImage::Downscale(Pixels.GetData(), Size, ThumbSize, Thumb);
+
+				const FString ThumbFilename = FPaths::GetBaseFilename(Filename) + TEXT("_thumb.png");
+				if(CTRLDocumentable::NodeImage::SavePng(MoveTemp(Thumb), ThumbSize, FPaths::GetPath(Filename) / ThumbFilename, Encoder))
+				{
+					Result.ThumbFilename = ThumbFilename;
+				}
+			}
+
+			{
+				FScopeLock ScopeLock(&ImageResultsLock);
+				ImageResults.Add(Filename, MoveTemp(Result));
+			}
+
+			if(SpriteSheets.IsValid())
+			{
+				SpriteSheets->Add(FPaths::GetPath(Filename), Filename, MoveTemp(Pixels), Size);
+				++NumNodeImagesWritten;
+			}
+			else if(!CTRLDocumentable::NodeImage::SavePng(MoveTemp(Pixels), Size, Filename, Encoder))
+			{
+				UE_LOG(LogCTRLDocumentable, Warning, TEXT("Failed to save screenshot image for node: %s"), *NodeName);
+			}
+			else
+			{
+				++NumNodeImagesWritten;
+			}
+		},
+		TStatId(), nullptr, ENamedThreads::AnyBackgroundThreadNormalTask));
 }
 
-inline FXmlNode* AppendChildRaw(FXmlNode* Parent, FString const& Name, FString const& TextContent)
+bool FDocumentationGenerator::TrimNodeImage(TArray64< FColor >& Pixels, FIntPoint& Size)
 {
-	Parent->AppendChildNode(Name, TextContent);
-	return Parent->GetChildrenNodes().Last();
+	// Boost the alpha and find the non-transparent bounds in one pass, then crop away the empty margins.
+	const FIntRect Bounds = CTRLDocumentable::NodeImage::MultiplyAlphaAndComputeBounds(Pixels.GetData(), Size, 2.f);
+	if(Bounds.Area() <= 0)
+	{
+		return false;
+	}
+	if(Bounds != FIntRect(FIntPoint::ZeroValue, Size))
+	{
+		TArray64< FColor > Cropped;
+		CTRLDocumentable::NodeImage::CropPixels(Pixels.GetData(), Size, Bounds, Cropped);
+		Pixels = MoveTemp(Cropped);
+		Size = Bounds.Size();
+	}
+	return true;
 }
 
-inline FXmlNode* AppendChildCDATA(FXmlNode* Parent, FString const& Name, FString const& TextContent)
+void FDocumentationGenerator::SealSpriteSheets()
 {
-	Parent->AppendChildNode(Name, WrapAsCDATA(TextContent));
-	return Parent->GetChildrenNodes().Last();
+	if(!SpriteSheets.IsValid())
+	{
+		return;
+	}
+
+	// Every image handed out so far has to be in the builder before it packs
+	FlushNodeImages();
+
+	TMap< FString, FNodeSpriteSheetBuilder::FPlacement > Placements;
+	SpriteSheets->Flush(Placements);
+
+	FScopeLock ScopeLock(&ImageResultsLock);
+	for(auto const& Placement : Placements)
+	{
+		FNodeImageResult& Result = ImageResults.FindOrAdd(Placement.Key);
+		Result.SheetFilename = Placement.Value.SheetFilename;
+		Result.SheetSize = Placement.Value.SheetSize;
+		Result.SpriteRect = Placement.Value.Rect;
+	}
 }
 
-// For K2 pins only!
-bool ExtractPinInformation(UEdGraphPin* Pin, FString& OutName, FString& OutType, FString& OutDescription)
+bool FDocumentationGenerator::FinalizeNodeImages(FDocModel& Model, bool bRunComplete)
 {
-	FString Tooltip;
-	Pin->GetOwningNode()->GetPinHoverText(*Pin, Tooltip);
-	if(!Tooltip.IsEmpty())
+	if(SpriteSheets.IsValid() && !bRunComplete)
 	{
-		// @NOTE: This is based on the formatting in UEdGraphSchema_K2::ConstructBasicPinTooltip.
-		// If that is changed, this will fail!
-		
-		auto TooltipPtr = *Tooltip;
+		// Sheets are packed once every image is in, sealing them per republish would split each class over many small ones
+		return false;
+	}
 
-		// Parse name line
-		FParse::Line(&TooltipPtr, OutName);
-		// Parse type line
-		FParse::Line(&TooltipPtr, OutType);
+	FlushNodeImages();
+	SealSpriteSheets();
 
-		// Currently there is an empty line here, but FParse::Line seems to gobble up empty lines as part of the previous call.
-		// Anyway, attempting here to deal with this generically in case that weird behaviour changes.
-		while(*TooltipPtr == TEXT('\n'))
+	FScopeLock ScopeLock(&ImageResultsLock);
+	for(auto It = PendingImageNodes.CreateIterator(); It; ++It)
+	{
+		// Nodes whose image hasn't been drawn yet stay pending for a later call
+		FNodeImageResult const* Result = ImageResults.Find(It.Key());
+		if(!Result)
 		{
-			FString Buf;
-			FParse::Line(&TooltipPtr, Buf);
+			continue;
 		}
 
-		// What remains is the description
-		OutDescription = TooltipPtr;
+		FDocNode& NodeInfo = Model.Nodes[It.Value()];
+		It.RemoveCurrent();
+		NodeInfo.bImgPending = false;
+
+		const FString RelImageDir = FPaths::GetPath(Model.GetString(NodeInfo.ImgPath));
+
+		// Lets the viewer reserve the space before the image arrives
+		NodeInfo.ImageSize = Result->Size;
+		NodeInfo.Placeholder = Model.Intern(Result->Placeholder);
+		if(!Result->ThumbFilename.IsEmpty())
+		{
+			NodeInfo.ThumbPath = Model.Intern(RelImageDir / Result->ThumbFilename);
+		}
+
+		if(!Result->SheetFilename.IsEmpty())
+		{
+			// imgPath now refers to the sheet, the sprite rect says where the node is on it
+			NodeInfo.ImgPath = Model.Intern(RelImageDir / Result->SheetFilename);
+			NodeInfo.bHasSprite = true;
+			NodeInfo.SpriteRect = Result->SpriteRect;
+			NodeInfo.SheetSize = Result->SheetSize;
+		}
 	}
 
-	// @NOTE: Currently overwriting the name and type as suspect this is more robust to future engine changes.
+	ImageResults.Reset();
+	return true;
+}
 
-	OutName = Pin->GetDisplayName().ToString();
-	if(OutName.IsEmpty() && Pin->PinType.PinCategory == UEdGraphSchema_K2::PC_Exec)
+FString FDocumentationGenerator::GetImageRootDir()
+{
+	return FPaths::Combine(IPluginManager::Get().FindPlugin("CTRLDocumentable")->GetBaseDir() + "/web/public/") / TEXT("img/");
+}
+
+bool FDocumentationGenerator::OptimizeNodeImages(TFunctionRef< bool() > ShouldCancel)
+{
+	// Nothing was written this run, so there's nothing to squeeze
+	if(Settings.ImageOptimizerCommand.IsEmpty() || NumNodeImagesWritten == 0)
 	{
-		OutName = Pin->Direction == EEdGraphPinDirection::EGPD_Input ? TEXT("In") : TEXT("Out");
+		return true;
 	}
 
-	OutType = UEdGraphSchema_K2::TypeToText(Pin->PinType).ToString();
+	FString ImageDir = FPaths::ConvertRelativePathToFull(GetImageRootDir());
+	FPaths::NormalizeDirectoryName(ImageDir);
 
-	return true;
+	// The executable may be quoted to keep spaces in its path, everything after it is passed as is
+	const FString CommandLine = Settings.ImageOptimizerCommand.Replace(TEXT("{dir}"), *ImageDir);
+	const TCHAR* Remaining = *CommandLine;
+	FString Executable;
+	if(!FParse::Token(Remaining, Executable, false))
+	{
+		UE_LOG(LogCTRLDocumentable, Warning, TEXT("Image optimizer command has no executable: %s"), *Settings.ImageOptimizerCommand);
+		return false;
+	}
+	const FString Args = FString(Remaining).TrimStart();
+
+	UE_LOG(LogCTRLDocumentable, Log, TEXT("Optimizing node images: %s %s"), *Executable, *Args);
+
+	FProcHandle Proc = FPlatformProcess::CreateProc(*Executable, *Args, true, true, true, nullptr, 0, *ImageDir, nullptr);
+	if(!Proc.IsValid())
+	{
+		UE_LOG(LogCTRLDocumentable, Warning, TEXT("Failed to launch image optimizer '%s'."), *Executable);
+		return false;
+	}
+
+	while(FPlatformProcess::IsProcRunning(Proc))
+	{
+		if(ShouldCancel())
+		{
+			FPlatformProcess::TerminateProc(Proc, true);
+			FPlatformProcess::CloseProc(Proc);
+			return false;
+		}
+		FPlatformProcess::Sleep(0.1f);
+	}
+
+	int32 ReturnCode = 0;
+	FPlatformProcess::GetProcReturnCode(Proc, &ReturnCode);
+	FPlatformProcess::CloseProc(Proc);
+
+	if(ReturnCode != 0)
+	{
+		UE_LOG(LogCTRLDocumentable, Warning, TEXT("Image optimizer exited with code %i."), ReturnCode);
+	}
+	return ReturnCode == 0;
+}
+
+inline FString WrapAsCDATA(FString const& InString)
+{
+	return TEXT("<![CDATA[") + InString + TEXT("]]>");
+}
+
+inline FXmlNode* AppendChild(FXmlNode* Parent, FString const& Name)
+{
+	Parent->AppendChildNode(Name, FString());
+	return Parent->GetChildrenNodes().Last();
+}
+
+inline FXmlNode* AppendChildRaw(FXmlNode* Parent, FString const& Name, FString const& TextContent)
+{
+	Parent->AppendChildNode(Name, TextContent);
+	return Parent->GetChildrenNodes().Last();
 }
 
+inline FXmlNode* AppendChildCDATA(FXmlNode* Parent, FString const& Name, FString const& TextContent)
+{
+	Parent->AppendChildNode(Name, WrapAsCDATA(TextContent));
+	return Parent->GetChildrenNodes().Last();
+}
 
 FString FDocumentationGenerator::GetFunctionFlags(UFunction* InFunction)
 {
@@ -385,181 +1000,159 @@ inline bool ShouldDocumentPin(UEdGraphPin* Pin)
 	return !Pin->bHidden;
 }
 
-bool FDocumentationGenerator::GenerateNodeDocs(UK2Node* Node, FNodeProcessingState& State, FJsonObject& ObjectMeta)
+bool FDocumentationGenerator::GenerateNodeDocs(UK2Node* Node, FNodeProcessingState& State, FDocModel& Model, int32& OutNodeIndex)
 {
 	SCOPE_SECONDS_COUNTER(GenerateNodeDocsTime);
-	FJsonObject* NodeInfo = new FJsonObject;
-	NodeInfo->SetStringField("docsName", DocsTitle);
+	FDocNode NodeInfo;
+	NodeInfo.DocsName = Model.Intern(DocsTitle);
 	const FString FriendlyClasId = GetClassDocId(State.AssociatedClass);
-	NodeInfo->SetStringField("classId", FriendlyClasId);
-	FString FriendlyClasName = FBlueprintEditorUtils::GetFriendlyClassDisplayName(State.AssociatedClass).ToString();
-	NodeInfo->SetStringField("className", FriendlyClasName);
-	FString NodeShortTitle = Node->GetNodeTitle(ENodeTitleType::ListView).ToString();
-	NodeInfo->SetStringField("shortTitle", NodeShortTitle.TrimEnd());
-	FString NodeFullTitle = Node->GetNodeTitle(ENodeTitleType::FullTitle).ToString();
+	NodeInfo.ClassId = Model.Intern(FriendlyClasId);
+	NodeInfo.ClassName = Model.InternText(FieldTexts->GetFriendlyClassName(State.AssociatedClass));
+	const FText NodeShortTitle = Node->GetNodeTitle(ENodeTitleType::ListView);
+	NodeInfo.ShortTitle = Model.InternText(NodeShortTitle.ToString().TrimEnd(), FDocTextSource{ NodeShortTitle });
+	const FText NodeFullTitleText = Node->GetNodeTitle(ENodeTitleType::FullTitle);
+	FString NodeFullTitle = NodeFullTitleText.ToString();
 	auto TargetIdx = NodeFullTitle.Find(TEXT("Target is "), ESearchCase::CaseSensitive);
 	if(TargetIdx != INDEX_NONE)
 	{
 		NodeFullTitle = NodeFullTitle.Left(TargetIdx).TrimEnd();
 	}
-	NodeInfo->SetStringField("fullTitle",NodeFullTitle);
-	FString NodeDesc = Node->GetTooltipText().ToString();
-	TargetIdx = NodeDesc.Find(TEXT("Target is "), ESearchCase::CaseSensitive);
-	if(TargetIdx != INDEX_NONE)
+	// Other cultures keep as many lines, the "Target is" line is translated too
+	int32 FullTitleLines = 1;
+	for(TCHAR Char : NodeFullTitle)
 	{
-		NodeDesc = NodeDesc.Left(TargetIdx).TrimEnd();
+		FullTitleLines += Char == TEXT('\n') ? 1 : 0;
 	}
-	NodeInfo->SetStringField("description", NodeDesc);
-	NodeInfo->SetStringField("imgPath", State.RelImageBasePath / State.ImageFilename);
-	NodeInfo->SetStringField("description", Node->GetMenuCategory().ToString());
-	TArray<TSharedPtr<FJsonValue>> Jinputs;
-	TArray<TSharedPtr<FJsonValue>> Joutputs;
-	for(auto Pin : Node->Pins)
+	NodeInfo.FullTitle = Model.InternText(NodeFullTitle, FDocTextSource{ NodeFullTitleText, EDocTextPart::FirstLines, FullTitleLines });
+	Model.SetNodeDescription(NodeInfo, Node->GetMenuCategory());
+	NodeInfo.ImgPath = Model.Intern(State.RelImageBasePath / State.ImageFilename);
+	if(auto CallNode = Cast< UK2Node_CallFunction >(Node))
 	{
-		if(Pin->Direction == EEdGraphPinDirection::EGPD_Input)
+		if(const UFunction* Function = CallNode->GetTargetFunction())
 		{
-			if(ShouldDocumentPin(Pin))
+			NodeInfo.Function = Model.Intern(Function->GetPathName());
+		}
+	}
+	NodeInfo.bImgDeferred = State.bImageDeferred;
+	NodeInfo.bImgPending = !State.bImageDeferred && State.bImagePending;
+
+	// Further contexts where the node differs, either unavailable or spawned with other pins
+	TArray< FDocStringId, TInlineAllocator< 4 > > UnavailableIn;
+	TArray< TPair< FDocStringId, UK2Node* >, TInlineAllocator< 4 > > Variants;
+	for(auto const& Variant : State.ContextVariants)
+	{
+		if(UClass* ContextClass = Variant.ContextClass.Get())
+		{
+			const FDocStringId ContextName = Model.Intern(ContextClass->GetName());
+			if(Variant.Node)
+			{
+				Variants.Emplace(ContextName, Variant.Node);
+			}
+			else
 			{
-				FJsonObject *JInput = new FJsonObject;
-				FString PinName, PinType, PinDesc;
-				ExtractPinInformation(Pin, PinName, PinType, PinDesc);
-				JInput->SetStringField("name", PinName);
-				JInput->SetStringField("type", PinType);
-				JInput->SetStringField("description", PinDesc.Len() > 0  ? PinDesc : "$no_comments");
-				Jinputs.Add(MakeShared<FJsonValueObject>(MakeShared<FJsonObject>(*JInput)));
+				UnavailableIn.Add(ContextName);
 			}
 		}
 	}
+	NodeInfo.UnavailableIn = Model.AddStringList(UnavailableIn);
 
-	for(auto Pin : Node->Pins)
+	TArray< FDocStringId, TInlineAllocator< 4 > > AvailableIn;
+	if(Variants.Num() > 0)
 	{
-		if(Pin->Direction == EEdGraphPinDirection::EGPD_Output)
+		AvailableIn.Add(Model.Intern(Settings.BlueprintContextClass->GetName()));
+		for(auto const& Context : OtherContexts)
 		{
-			if(ShouldDocumentPin(Pin))
+			UClass* ContextClass = Context.Key.Get();
+			const FDocStringId ContextName = ContextClass ? Model.Intern(ContextClass->GetName()) : 0;
+			if(ContextName != 0 && !UnavailableIn.Contains(ContextName))
 			{
-				FString PinName, PinType, PinDesc;
-				ExtractPinInformation(Pin, PinName, PinType, PinDesc);
-				FJsonObject *JOutput = new FJsonObject;
-				JOutput->SetStringField("name", PinName);
-				JOutput->SetStringField("type", PinType);
-				JOutput->SetStringField("description", PinDesc.Len() > 0  ? PinDesc : "$no_comments");
-				Joutputs.Add(MakeShared<FJsonValueObject>(MakeShared<FJsonObject>(*JOutput)));
+				AvailableIn.Add(ContextName);
 			}
 		}
 	}
-	NodeInfo->SetArrayField("inputs", Jinputs);
-	NodeInfo->SetArrayField("outputs", Joutputs);
-	ObjectMeta = *NodeInfo;
-	
-	return true;
-}
 
-
-FString FDocumentationGenerator::ExtractFunctionDescription(const FString& FunctionTooltip)
-{
-	FString Result = "";
-	FString CurrentStr;
-
-	auto TooltipPtr = *FunctionTooltip;
-
-	while (FParse::Line(&TooltipPtr, CurrentStr, true))
+	// A pin whose type changes with the context is documented once per type, as HasSamePins tells the variants apart
+	auto IsSamePin = [](UEdGraphPin* A, UEdGraphPin* B)
+	{
+		return A->Direction == B->Direction && A->PinName == B->PinName && A->PinType == B->PinType;
+	};
+	auto FindVisiblePin = [&IsSamePin](UK2Node* InNode, UEdGraphPin* Pin) -> UEdGraphPin*
 	{
-		if (!CurrentStr.IsEmpty())
+		for(auto Other : InNode->Pins)
 		{
-			TArray<FString> Out;
-			CurrentStr = CurrentStr.TrimStartAndEnd();
-			CurrentStr.ParseIntoArray(Out, TEXT(" "), true);
-    		if (Out.Num() > 1 && (Out[0].Equals("@param", ESearchCase::IgnoreCase) || Out[0].Equals("@return", ESearchCase::IgnoreCase)))
+			if(ShouldDocumentPin(Other) && IsSamePin(Other, Pin))
 			{
-				break;
+				return Other;
 			}
-			Result += JoinArrayOfStrings(Out);
 		}
+		return nullptr;
+	};
 
-	}
-	if (Result.EndsWith("\n"))
+	// Pins showing in every context the node is available in are left unannotated
+	auto GetPinContexts = [&](UEdGraphPin* Pin, bool bInMainContext) -> FDocRange
 	{
-		Result.RemoveAt(Result.Len() - 1, 1);
-		Result = Result.TrimStartAndEnd();
-	}
-	return Result;
-}
-
-FString FDocumentationGenerator::ExtractFunctionParamDescription(const FString& FunctionTooltip, const FString& ParamName, const FString& DefaultTooltip, bool ExtractReturnInfo)
-{
-	FString Result;
-	FString CurrentStr;
-	bool    Found = false;
-
-	auto TooltipPtr = *FunctionTooltip;
+		TArray< FDocStringId, TInlineAllocator< 4 > > Contexts;
+		for(FDocStringId ContextName : AvailableIn)
+		{
+			auto const* Variant = Variants.FindByPredicate([ContextName](auto const& Entry) { return Entry.Key == ContextName; });
+			if(Variant ? FindVisiblePin(Variant->Value, Pin) != nullptr : bInMainContext)
+			{
+				Contexts.Add(ContextName);
+			}
+		}
+		return Contexts.Num() == AvailableIn.Num() ? FDocRange() : Model.AddStringList(Contexts);
+	};
 
-	while (FParse::Line(&TooltipPtr, CurrentStr, true))
+	const FDocStringId NoComments = Model.Intern(TEXT("$no_comments"));
+	FPinDocExtractor::FPinDoc PinDoc;
+	auto AddPin = [&](UEdGraphPin* Pin, bool bInMainContext)
+	{
+		PinDocs->Extract(Pin, PinDoc);
+		FDocPin& DocPin = Model.Pins.AddDefaulted_GetRef();
+		DocPin.Name = Model.InternText(PinDoc.Name);
+		DocPin.Type = Model.InternText(PinDoc.Type);
+		DocPin.Description = PinDoc.Description.Len() > 0 ? Model.InternText(PinDoc.Description, PinDoc.DescriptionSource) : NoComments;
+		DocPin.Contexts = GetPinContexts(Pin, bInMainContext);
+	};
+	auto AddPins = [&](EEdGraphPinDirection Direction) -> FDocRange
 	{
-		if (!CurrentStr.IsEmpty())
+		FDocRange Range{ Model.Pins.Num(), 0 };
+		for(auto Pin : Node->Pins)
 		{
-			TArray<FString> Out;
-			CurrentStr = CurrentStr.TrimStartAndEnd();
-			CurrentStr.ParseIntoArray(Out, TEXT(" "), true);
-			if (!Found)
+			if(Pin->Direction == Direction && ShouldDocumentPin(Pin))
 			{
-				if (Out.Num() > 1 && ((Out[0].Equals("@param", ESearchCase::IgnoreCase) && Out[1].Equals(ParamName, ESearchCase::IgnoreCase))))
-				{
-					Found = true;
-					Result += JoinArrayOfStrings(Out, 2);
-				}
-				else if (Out.Num() > 0 && (ExtractReturnInfo && Out[0].Equals("@return", ESearchCase::IgnoreCase)))
-				{
-					Found = true;
-					Result += JoinArrayOfStrings(Out, 1);
-				}
+				AddPin(Pin, true);
 			}
-			else
+		}
+
+		// Merged in once, from the first context they show up in
+		TArray< UEdGraphPin*, TInlineAllocator< 8 > > ContextOnlyPins;
+		for(auto const& Variant : Variants)
+		{
+			for(auto Pin : Variant.Value->Pins)
 			{
-				if (Out.Num() > 1 && (Out[0].Equals("@param", ESearchCase::IgnoreCase) || Out[0].Equals("@return", ESearchCase::IgnoreCase)))
+				if(Pin->Direction == Direction && ShouldDocumentPin(Pin) && !FindVisiblePin(Node, Pin)
+					&& !ContextOnlyPins.ContainsByPredicate([&](UEdGraphPin* Added) { return IsSamePin(Added, Pin); }))
 				{
-					break;
+					ContextOnlyPins.Add(Pin);
+					AddPin(Pin, false);
 				}
-				Result += JoinArrayOfStrings(Out);
 			}
 		}
+		Range.Num = Model.Pins.Num() - Range.First;
+		return Range;
+	};
+	NodeInfo.Inputs = AddPins(EEdGraphPinDirection::EGPD_Input);
+	NodeInfo.Outputs = AddPins(EEdGraphPinDirection::EGPD_Output);
 
-	}
-	
-	if (!Found)
-	{
-		return DefaultTooltip;
-	}
-
-	if (Result.EndsWith("\n"))
-	{
-		Result.RemoveAt(Result.Len() - 1, 1);
-		Result = Result.TrimStartAndEnd();
-	}
-
-	return Result;
-}
-
-FString FDocumentationGenerator::JoinArrayOfStrings(const TArray<FString>& Array, int Start, bool AddLineEndings)
-{
-	FString ResultString = "";
-
-	if (!(Array.Num() > Start))
-	{
-		return FString();
-	}
-
-	for (int i = Start; i < Array.Num(); i++)
-	{
-		ResultString += Array[i] + " ";
-	}
+	OutNodeIndex = Model.Nodes.Add(NodeInfo);
 
-	if (AddLineEndings)
+	if(!State.ImageAbsolutePath.IsEmpty())
 	{
-		ResultString += "\n";
+		PendingImageNodes.Add(State.ImageAbsolutePath, OutNodeIndex);
 	}
-
-	return ResultString;
-
+	
+	return true;
 }
 
 
@@ -593,6 +1186,17 @@ FString FDocumentationGenerator::GetClassDocId(UClass* Class)
 	return DocId;
 }
 
+FDocComment const& FDocumentationGenerator::GetDocComment(const UFunction* Function)
+{
+	return DocComments->Get(Function);
+}
+
+void FDocumentationGenerator::ResetTextCaches()
+{
+	DocComments->Reset();
+	FieldTexts->Reset();
+}
+
 FString FDocumentationGenerator::GetNodeDocId(UEdGraphNode* Node)
 {
 	// @TODO: Not sure this is right thing to use
@@ -9,6 +9,8 @@
 #include "CTRLDocumentableLog.h"
 #include "Engine/Blueprint.h"
 #include "Animation/AnimBlueprint.h"
+#include "Engine/UserDefinedStruct.h"
+#include "Engine/UserDefinedEnum.h"
 #include "AssetRegistry/AssetRegistryModule.h"
 #include "ControlRigDeveloper/Public/ControlRigBlueprint.h"
 
@@ -31,6 +33,8 @@ void FContentPathEnumerator::Prepass(FName const& Path)
 	Filter.bRecursiveClasses = true;
 	//Filter.ClassNames.Add(UBlueprint::StaticClass()->GetFName());
 	Filter.ClassPaths.Add(FTopLevelAssetPath(UBlueprint::StaticClass()->GetPathName()));
+	Filter.ClassPaths.Add(UUserDefinedStruct::StaticClass()->GetClassPathName());
+	Filter.ClassPaths.Add(UUserDefinedEnum::StaticClass()->GetClassPathName());
 	
 	// @TODO: Not sure about this, but for some reason was generating docs for 'AnimInstance' itself.
 	// Filter.RecursiveClassesExclusionSet.Add(UAnimBlueprint::StaticClass()->GetFName());
@@ -52,17 +56,25 @@ UObject* FContentPathEnumerator::GetNext()
 		auto const& AssetData = AssetList[CurIndex];
 		++CurIndex;
 
-		if (auto Struct = Cast<UScriptStruct>(AssetData.GetAsset()))
+		UObject* Asset = AssetData.GetAsset();
+
+		if (auto Struct = Cast<UScriptStruct>(Asset))
 		{
-			UE_LOG(LogCTRLDocumentable, Log, TEXT("Found new struct '%s' at '%s'"), *Struct->GetName(), *AssetData.ObjectPath.ToString());
+			UE_LOG(LogCTRLDocumentable, Log, TEXT("Enumerating struct '%s' at '%s'"), *Struct->GetName(), *AssetData.ObjectPath.ToString());
+
+			Result = Struct;
+			break;
 		}
 
-		if (auto Enum = Cast<UEnum>(AssetData.GetAsset()))
+		if (auto Enum = Cast<UEnum>(Asset))
 		{
-			UE_LOG(LogCTRLDocumentable, Log, TEXT("Found new enum '%s' at '%s'"), *Enum->GetName(), *AssetData.ObjectPath.ToString());
+			UE_LOG(LogCTRLDocumentable, Log, TEXT("Enumerating enum '%s' at '%s'"), *Enum->GetName(), *AssetData.ObjectPath.ToString());
+
+			Result = Enum;
+			break;
 		}
 
-		if(auto Blueprint = Cast< UBlueprint >(AssetData.GetAsset()))
+		if(auto Blueprint = Cast< UBlueprint >(Asset))
 		{
 			if (Blueprint->IsA(UControlRigBlueprint::StaticClass()))
 				continue;
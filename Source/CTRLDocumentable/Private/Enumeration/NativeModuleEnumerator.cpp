@@ -54,14 +54,15 @@ void FNativeModuleEnumerator::Prepass(FName const& ModuleName)
 
 		UObject* ObjectToProcess = nullptr;
 
+		// Structs and enums are documented from this same walk, they have no nodes of their own
 		if (auto Struct = Cast<UScriptStruct>(Obj))
 		{
-			UE_LOG(LogCTRLDocumentable, Log, TEXT("Found new Native struct '%s'"), *Struct->GetName());
+			ObjectToProcess = Struct;
 		}
 
 		if (auto Enum = Cast<UEnum>(Obj))
 		{
-			UE_LOG(LogCTRLDocumentable, Log, TEXT("Found new Native enum '%s'"), *Enum->GetName());
+			ObjectToProcess = Enum;
 		}
 
 		// Native class?
@@ -0,0 +1,343 @@
+// This Source Code Form is subject to the terms of the Mozilla Public
+// License, v. 2.0. If a copy of the MPL was not distributed with this
+// file, You can obtain one at http://mozilla.org/MPL/2.0/.
+
+// Copyright (C) 2023-2025 NTY.studio. All Rights Reserved.
+
+#include "FastPngEncoder.h"
+
+
+namespace CTRLDocumentable::FastPng
+{
+
+	namespace
+	{
+		/** Static tables for CRC-32, and bit-reversed fixed Huffman codes (RFC 1951, 3.2.6). */
+		struct FTables
+		{
+			uint32 Crc[256];
+
+			uint16 LitCode[288];
+			uint8 LitBits[288];
+			uint8 DistCode[30];
+
+			uint16 LengthSymbol[259];
+			uint8 LengthExtraBits[259];
+			uint16 LengthExtraValue[259];
+
+			FTables()
+			{
+				for(uint32 N = 0; N < 256; ++N)
+				{
+					uint32 C = N;
+					for(int32 K = 0; K < 8; ++K)
+					{
+						C = (C & 1) ? 0xEDB88320u ^ (C >> 1) : C >> 1;
+					}
+					Crc[N] = C;
+				}
+
+				for(uint32 Sym = 0; Sym < 288; ++Sym)
+				{
+					uint32 Code;
+					uint8 Bits;
+					if(Sym < 144)      { Code = 0x30 + Sym;          Bits = 8; }
+					else if(Sym < 256) { Code = 0x190 + (Sym - 144); Bits = 9; }
+					else if(Sym < 280) { Code = Sym - 256;           Bits = 7; }
+					else               { Code = 0xC0 + (Sym - 280);  Bits = 8; }
+					LitCode[Sym] = (uint16)Reverse(Code, Bits);
+					LitBits[Sym] = Bits;
+				}
+
+				for(uint32 Sym = 0; Sym < 30; ++Sym)
+				{
+					DistCode[Sym] = (uint8)Reverse(Sym, 5);
+				}
+
+				static const uint16 LengthBase[29] = { 3, 4, 5, 6, 7, 8, 9, 10, 11, 13, 15, 17, 19, 23, 27, 31, 35, 43, 51, 59, 67, 83, 99, 115, 131, 163, 195, 227, 258 };
+				static const uint8 LengthExtra[29] = { 0, 0, 0, 0, 0, 0, 0, 0, 1, 1, 1, 1, 2, 2, 2, 2, 3, 3, 3, 3, 4, 4, 4, 4, 5, 5, 5, 5, 0 };
+				for(int32 Code = 0; Code < 29; ++Code)
+				{
+					const int32 Last = Code == 28 ? 258 : LengthBase[Code] + (1 << LengthExtra[Code]) - 1;
+					for(int32 Len = LengthBase[Code]; Len <= Last && Len <= 258; ++Len)
+					{
+						LengthSymbol[Len] = (uint16)(257 + Code);
+						LengthExtraBits[Len] = LengthExtra[Code];
+						LengthExtraValue[Len] = (uint16)(Len - LengthBase[Code]);
+					}
+				}
+			}
+
+			static uint32 Reverse(uint32 Code, uint32 Bits)
+			{
+				uint32 Result = 0;
+				for(uint32 Idx = 0; Idx < Bits; ++Idx)
+				{
+					Result = (Result << 1) | ((Code >> Idx) & 1);
+				}
+				return Result;
+			}
+		};
+
+		static FTables const& GetTables()
+		{
+			static const FTables Tables;
+			return Tables;
+		}
+
+		static const uint16 DistBase[30] = { 1, 2, 3, 4, 5, 7, 9, 13, 17, 25, 33, 49, 65, 97, 129, 193, 257, 385, 513, 769, 1025, 1537, 2049, 3073, 4097, 6145, 8193, 12289, 16385, 24577 };
+		static const uint8 DistExtra[30] = { 0, 0, 0, 0, 1, 1, 2, 2, 3, 3, 4, 4, 5, 5, 6, 6, 7, 7, 8, 8, 9, 9, 10, 10, 11, 11, 12, 12, 13, 13 };
+
+		class FBitWriter
+		{
+		public:
+			explicit FBitWriter(TArray64< uint8 >& InOut) : Out(InOut) {}
+
+			FORCEINLINE void Put(uint32 Value, uint32 Bits)
+			{
+				Accumulator |= (uint64)Value << Count;
+				Count += Bits;
+				while(Count >= 8)
+				{
+					Out.Add((uint8)Accumulator);
+					Accumulator >>= 8;
+					Count -= 8;
+				}
+			}
+
+			void Flush()
+			{
+				if(Count > 0)
+				{
+					Out.Add((uint8)Accumulator);
+				}
+				Accumulator = 0;
+				Count = 0;
+			}
+
+		private:
+			TArray64< uint8 >& Out;
+			uint64 Accumulator = 0;
+			uint32 Count = 0;
+		};
+
+		static uint32 UpdateCrc(uint32 Crc, const uint8* Data, int64 Len)
+		{
+			auto const& Table = GetTables().Crc;
+			for(int64 Idx = 0; Idx < Len; ++Idx)
+			{
+				Crc = Table[(Crc ^ Data[Idx]) & 0xFF] ^ (Crc >> 8);
+			}
+			return Crc;
+		}
+
+		static uint32 Adler32(const uint8* Data, int64 Len)
+		{
+			uint32 A = 1;
+			uint32 B = 0;
+			while(Len > 0)
+			{
+				// 5552 is the largest block that cannot overflow before the modulo
+				const int64 Block = FMath::Min< int64 >(Len, 5552);
+				for(int64 Idx = 0; Idx < Block; ++Idx)
+				{
+					A += Data[Idx];
+					B += A;
+				}
+				A %= 65521;
+				B %= 65521;
+				Data += Block;
+				Len -= Block;
+			}
+			return (B << 16) | A;
+		}
+
+		static void PutBigEndian(TArray64< uint8 >& Out, uint32 Value)
+		{
+			Out.Add((uint8)(Value >> 24));
+			Out.Add((uint8)(Value >> 16));
+			Out.Add((uint8)(Value >> 8));
+			Out.Add((uint8)Value);
+		}
+
+		static void WriteChunk(TArray64< uint8 >& Out, const char* Type, const uint8* Data, int64 Len)
+		{
+			PutBigEndian(Out, (uint32)Len);
+			const int64 TypeStart = Out.Num();
+			Out.Append(reinterpret_cast< const uint8* >(Type), 4);
+			Out.Append(Data, Len);
+			PutBigEndian(Out, UpdateCrc(0xFFFFFFFFu, Out.GetData() + TypeStart, Len + 4) ^ 0xFFFFFFFFu);
+		}
+
+		/** zlib stream holding a single fixed-Huffman deflate block. */
+		static void Deflate(const uint8* Data, int64 Len, TArray64< uint8 >& Out)
+		{
+			auto const& Tables = GetTables();
+
+			Out.Add(0x78);
+			Out.Add(0x01);
+
+			FBitWriter Bits(Out);
+			Bits.Put(1, 1);	// BFINAL
+			Bits.Put(1, 2);	// BTYPE = fixed Huffman
+
+			auto PutLiteral = [&](uint32 Sym)
+			{
+				Bits.Put(Tables.LitCode[Sym], Tables.LitBits[Sym]);
+			};
+
+			constexpr int32 HashBits = 14;
+			constexpr int32 MinMatch = 4;
+			constexpr int32 MaxMatch = 258;
+			constexpr int64 WindowSize = 32768;
+
+			TArray< int64 > Head;
+			Head.Init(-1, 1 << HashBits);
+
+			auto Hash = [](const uint8* P)
+			{
+				uint32 V;
+				FMemory::Memcpy(&V, P, 4);
+				return (V * 2654435761u) >> (32 - HashBits);
+			};
+
+			int64 Pos = 0;
+			while(Pos < Len)
+			{
+				int32 MatchLen = 0;
+				int64 MatchDist = 0;
+
+				if(Pos + MinMatch <= Len)
+				{
+					const uint32 H = Hash(Data + Pos);
+					const int64 Candidate = Head[H];
+					Head[H] = Pos;
+
+					if(Candidate >= 0 && Pos - Candidate <= WindowSize)
+					{
+						const int32 Limit = (int32)FMath::Min< int64 >(MaxMatch, Len - Pos);
+						int32 L = 0;
+						while(L < Limit && Data[Candidate + L] == Data[Pos + L])
+						{
+							++L;
+						}
+						if(L >= MinMatch)
+						{
+							MatchLen = L;
+							MatchDist = Pos - Candidate;
+						}
+					}
+				}
+
+				if(MatchLen == 0)
+				{
+					PutLiteral(Data[Pos]);
+					++Pos;
+					continue;
+				}
+
+				PutLiteral(Tables.LengthSymbol[MatchLen]);
+				if(Tables.LengthExtraBits[MatchLen] > 0)
+				{
+					Bits.Put(Tables.LengthExtraValue[MatchLen], Tables.LengthExtraBits[MatchLen]);
+				}
+
+				int32 DistSym = 29;
+				while(DistBase[DistSym] > MatchDist)
+				{
+					--DistSym;
+				}
+				Bits.Put(Tables.DistCode[DistSym], 5);
+				if(DistExtra[DistSym] > 0)
+				{
+					Bits.Put((uint32)(MatchDist - DistBase[DistSym]), DistExtra[DistSym]);
+				}
+
+				// Keep the hash table warm at the end of the match so long runs chain into each other
+				const int64 End = Pos + MatchLen;
+				if(End + MinMatch <= Len)
+				{
+					Head[Hash(Data + End - 1)] = End - 1;
+				}
+				Pos = End;
+			}
+
+			PutLiteral(256);	// End of block
+			Bits.Flush();
+
+			PutBigEndian(Out, Adler32(Data, Len));
+		}
+	}
+
+	void Encode(const FColor* Pixels, FIntPoint Size, TArray64< uint8 >& OutPng)
+	{
+		const int64 RowBytes = (int64)Size.X * 4;
+
+		// Filtered scanlines: one filter byte, then RGBA. Row 0 uses Sub, the rest use Up.
+		TArray64< uint8 > Filtered;
+		Filtered.SetNumUninitialized((RowBytes + 1) * Size.Y);
+		uint8* Dest = Filtered.GetData();
+
+		TArray64< uint8 > PrevRow;
+		PrevRow.SetNumZeroed(RowBytes);
+		TArray64< uint8 > CurRow;
+		CurRow.SetNumUninitialized(RowBytes);
+
+		for(int32 Y = 0; Y < Size.Y; ++Y)
+		{
+			const FColor* Src = Pixels + (int64)Y * Size.X;
+			uint8* Row = CurRow.GetData();
+			for(int32 X = 0; X < Size.X; ++X)
+			{
+				Row[X * 4 + 0] = Src[X].R;
+				Row[X * 4 + 1] = Src[X].G;
+				Row[X * 4 + 2] = Src[X].B;
+				Row[X * 4 + 3] = Src[X].A;
+			}
+
+			if(Y == 0)
+			{
+				*Dest++ = 1;
+				for(int64 Idx = 0; Idx < RowBytes; ++Idx)
+				{
+					*Dest++ = (uint8)(Row[Idx] - (Idx >= 4 ? Row[Idx - 4] : 0));
+				}
+			}
+			else
+			{
+				*Dest++ = 2;
+				const uint8* Prev = PrevRow.GetData();
+				for(int64 Idx = 0; Idx < RowBytes; ++Idx)
+				{
+					*Dest++ = (uint8)(Row[Idx] - Prev[Idx]);
+				}
+			}
+
+			Swap(PrevRow, CurRow);
+		}
+
+		OutPng.Reset();
+		OutPng.Reserve(Filtered.Num() / 4 + 1024);
+
+		static const uint8 Signature[8] = { 0x89, 'P', 'N', 'G', '\r', '\n', 0x1A, '\n' };
+		OutPng.Append(Signature, 8);
+
+		uint8 Header[13];
+		Header[0] = (uint8)(Size.X >> 24); Header[1] = (uint8)(Size.X >> 16); Header[2] = (uint8)(Size.X >> 8); Header[3] = (uint8)Size.X;
+		Header[4] = (uint8)(Size.Y >> 24); Header[5] = (uint8)(Size.Y >> 16); Header[6] = (uint8)(Size.Y >> 8); Header[7] = (uint8)Size.Y;
+		Header[8] = 8;	// Bit depth
+		Header[9] = 6;	// RGBA
+		Header[10] = 0;
+		Header[11] = 0;
+		Header[12] = 0;
+		WriteChunk(OutPng, "IHDR", Header, sizeof(Header));
+
+		TArray64< uint8 > Compressed;
+		Compressed.Reserve(Filtered.Num() / 4 + 64);
+		Deflate(Filtered.GetData(), Filtered.Num(), Compressed);
+		WriteChunk(OutPng, "IDAT", Compressed.GetData(), Compressed.Num());
+
+		WriteChunk(OutPng, "IEND", nullptr, 0);
+	}
+
+}
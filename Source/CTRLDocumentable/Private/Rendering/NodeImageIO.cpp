@@ -0,0 +1,50 @@
+// This Source Code Form is subject to the terms of the Mozilla Public
+// License, v. 2.0. If a copy of the MPL was not distributed with this
+// file, You can obtain one at http://mozilla.org/MPL/2.0/.
+
+// Copyright (C) 2023-2025 NTY.studio. All Rights Reserved.
+
+#include "NodeImageIO.h"
+#include "FastPngEncoder.h"
+#include "NodeImageKernels.h"
+#include "Misc/Base64.h"
+#include "Misc/FileHelper.h"
+#include "ImageWriteTask.h"
+
+
+namespace CTRLDocumentable::NodeImage
+{
+
+	bool SavePng(TArray64< FColor >&& Pixels, FIntPoint Size, FString const& Filename, ENodeImageEncoder Encoder)
+	{
+		if(Encoder == ENodeImageEncoder::Fast)
+		{
+			TArray64< uint8 > Png;
+			FastPng::Encode(Pixels.GetData(), Size, Png);
+			return FFileHelper::SaveArrayToFile(Png, *Filename);
+		}
+
+		TUniquePtr<FImageWriteTask> ImageTask = MakeUnique<FImageWriteTask>();
+		ImageTask->PixelData = MakeUnique<TImagePixelData<FColor>>(Size, MoveTemp(Pixels));
+		ImageTask->Filename = Filename;
+		ImageTask->Format = EImageFormat::PNG;
+		ImageTask->CompressionQuality = (int32)EImageCompressionQuality::Default;
+		ImageTask->bOverwriteFile = true;
+
+		return ImageTask->RunTask();
+	}
+
+	FString MakePlaceholderDataUri(const FColor* Pixels, FIntPoint Size, int32 MaxEdge)
+	{
+		const FIntPoint TinySize = FitWithin(Size, MaxEdge);
+
+		TArray64< FColor > Tiny;
+		Downscale(Pixels, Size, TinySize, Tiny);
+
+		TArray64< uint8 > Png;
+		FastPng::Encode(Tiny.GetData(), TinySize, Png);
+
+		return TEXT("data:image/png;base64,") + FBase64::Encode(Png.GetData(), (uint32)Png.Num());
+	}
+
+}
@@ -0,0 +1,22 @@
+// This Source Code Form is subject to the terms of the Mozilla Public
+// License, v. 2.0. If a copy of the MPL was not distributed with this
+// file, You can obtain one at http://mozilla.org/MPL/2.0/.
+
+// Copyright (C) 2023-2025 NTY.studio. All Rights Reserved.
+
+#pragma once
+
+#include "CoreMinimal.h"
+#include "GenerationSettings.h"
+
+
+namespace CTRLDocumentable::NodeImage
+{
+
+	/** Encode BGRA pixels as PNG with the chosen encoder and write them to Filename. Callable from any thread. */
+	bool SavePng(TArray64< FColor >&& Pixels, FIntPoint Size, FString const& Filename, ENodeImageEncoder Encoder);
+
+	/** A few hundred bytes at most: the image shrunk to MaxEdge pixels, as an inline PNG data URI for blurred placeholders. */
+	FString MakePlaceholderDataUri(const FColor* Pixels, FIntPoint Size, int32 MaxEdge);
+
+}
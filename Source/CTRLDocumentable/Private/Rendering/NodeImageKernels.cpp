@@ -0,0 +1,184 @@
+// This Source Code Form is subject to the terms of the Mozilla Public
+// License, v. 2.0. If a copy of the MPL was not distributed with this
+// file, You can obtain one at http://mozilla.org/MPL/2.0/.
+
+// Copyright (C) 2023-2025 NTY.studio. All Rights Reserved.
+
+#include "NodeImageKernels.h"
+
+#define CTRLDOC_NODEIMAGE_SSE2 (PLATFORM_ENABLE_VECTORINTRINSICS && PLATFORM_CPU_X86_FAMILY)
+
+#if CTRLDOC_NODEIMAGE_SSE2
+#include <emmintrin.h>
+#endif
+
+
+namespace CTRLDocumentable::NodeImage
+{
+
+	// FColor is stored BGRA in memory, so on little endian targets alpha is the top byte of each 32-bit pixel.
+	static_assert(PLATFORM_LITTLE_ENDIAN, "Node image kernels assume a little endian FColor layout.");
+
+	static constexpr uint32 AlphaShift = 24;
+	static constexpr uint32 ColorMask = 0x00FFFFFFu;
+
+	/** Alpha multiplier in 8.8 fixed point. Capped at 128 so that 255 * Multiplier still fits a signed 16-bit lane. */
+	static uint32 ToFixedMultiplier(float AlphaMultiplier)
+	{
+		return (uint32)FMath::RoundToInt(FMath::Clamp(AlphaMultiplier, 0.0f, 128.0f) * 256.0f);
+	}
+
+	FORCEINLINE static uint32 MultiplyAlphaScalar(uint32& Pixel, uint32 FixedMultiplier)
+	{
+		const uint32 Alpha = FMath::Min< uint32 >(((Pixel >> AlphaShift) * FixedMultiplier) >> 8, 255u);
+		Pixel = (Pixel & ColorMask) | (Alpha << AlphaShift);
+		return Alpha;
+	}
+
+	FIntRect MultiplyAlphaAndComputeBounds(FColor* Pixels, FIntPoint Size, float AlphaMultiplier)
+	{
+		const uint32 FixedMultiplier = ToFixedMultiplier(AlphaMultiplier);
+
+		int32 MinX = Size.X;
+		int32 MaxX = -1;
+		int32 MinY = Size.Y;
+		int32 MaxY = -1;
+
+#if CTRLDOC_NODEIMAGE_SSE2
+		const __m128i ColorMaskVec = _mm_set1_epi32(ColorMask);
+		const __m128i MultiplierVec = _mm_set1_epi32(FixedMultiplier);
+		const __m128i MaxAlphaVec = _mm_set1_epi32(255);
+		const __m128i ZeroVec = _mm_setzero_si128();
+#endif
+
+		for(int32 Y = 0; Y < Size.Y; ++Y)
+		{
+			uint32* Row = reinterpret_cast< uint32* >(Pixels + (int64)Y * Size.X);
+			int32 RowMinX = INDEX_NONE;
+			int32 RowMaxX = INDEX_NONE;
+			int32 X = 0;
+
+#if CTRLDOC_NODEIMAGE_SSE2
+			for(; X + 4 <= Size.X; X += 4)
+			{
+				__m128i Quad = _mm_loadu_si128(reinterpret_cast< const __m128i* >(Row + X));
+
+				// Alpha sits in the low byte of each 32-bit lane after the shift. Moving it into the high byte of the
+				// low 16-bit half lets mulhi_epu16 compute (Alpha * Multiplier) >> 8 without widening.
+				const __m128i Alpha = _mm_srli_epi32(Quad, AlphaShift);
+				__m128i NewAlpha = _mm_mulhi_epu16(_mm_slli_epi32(Alpha, 8), MultiplierVec);
+				NewAlpha = _mm_min_epi16(NewAlpha, MaxAlphaVec);
+
+				Quad = _mm_or_si128(_mm_and_si128(Quad, ColorMaskVec), _mm_slli_epi32(NewAlpha, AlphaShift));
+				_mm_storeu_si128(reinterpret_cast< __m128i* >(Row + X), Quad);
+
+				const uint32 OpaqueMask = ~(uint32)_mm_movemask_ps(_mm_castsi128_ps(_mm_cmpeq_epi32(NewAlpha, ZeroVec))) & 0xFu;
+				if(OpaqueMask != 0)
+				{
+					if(RowMinX == INDEX_NONE)
+					{
+						RowMinX = X + (int32)FMath::CountTrailingZeros(OpaqueMask);
+					}
+					RowMaxX = X + (int32)FMath::FloorLog2(OpaqueMask);
+				}
+			}
+#endif
+
+			for(; X < Size.X; ++X)
+			{
+				if(MultiplyAlphaScalar(Row[X], FixedMultiplier) != 0)
+				{
+					if(RowMinX == INDEX_NONE)
+					{
+						RowMinX = X;
+					}
+					RowMaxX = X;
+				}
+			}
+
+			if(RowMinX != INDEX_NONE)
+			{
+				MinX = FMath::Min(MinX, RowMinX);
+				MaxX = FMath::Max(MaxX, RowMaxX);
+				MinY = FMath::Min(MinY, Y);
+				MaxY = Y;
+			}
+		}
+
+		if(MaxY < 0)
+		{
+			return FIntRect();
+		}
+
+		return FIntRect(MinX, MinY, MaxX + 1, MaxY + 1);
+	}
+
+	void CropPixels(const FColor* Pixels, FIntPoint Size, FIntRect const& Rect, TArray64< FColor >& OutPixels)
+	{
+		check(Rect.Min.X >= 0 && Rect.Min.Y >= 0 && Rect.Max.X <= Size.X && Rect.Max.Y <= Size.Y);
+
+		const int32 Width = Rect.Width();
+		OutPixels.SetNumUninitialized((int64)Width * Rect.Height());
+
+		FColor* Dest = OutPixels.GetData();
+		for(int32 Y = Rect.Min.Y; Y < Rect.Max.Y; ++Y)
+		{
+			FMemory::Memcpy(Dest, Pixels + (int64)Y * Size.X + Rect.Min.X, Width * sizeof(FColor));
+			Dest += Width;
+		}
+	}
+
+	void Downscale(const FColor* Pixels, FIntPoint Size, FIntPoint DstSize, TArray64< FColor >& OutPixels)
+	{
+		check(DstSize.X > 0 && DstSize.Y > 0 && DstSize.X <= Size.X && DstSize.Y <= Size.Y);
+
+		OutPixels.SetNumUninitialized((int64)DstSize.X * DstSize.Y);
+
+		for(int32 DY = 0; DY < DstSize.Y; ++DY)
+		{
+			const int32 Y0 = (int32)((int64)DY * Size.Y / DstSize.Y);
+			const int32 Y1 = FMath::Max(Y0 + 1, (int32)((int64)(DY + 1) * Size.Y / DstSize.Y));
+
+			for(int32 DX = 0; DX < DstSize.X; ++DX)
+			{
+				const int32 X0 = (int32)((int64)DX * Size.X / DstSize.X);
+				const int32 X1 = FMath::Max(X0 + 1, (int32)((int64)(DX + 1) * Size.X / DstSize.X));
+
+				uint64 R = 0, G = 0, B = 0, A = 0;
+				for(int32 Y = Y0; Y < Y1; ++Y)
+				{
+					const FColor* Row = Pixels + (int64)Y * Size.X;
+					for(int32 X = X0; X < X1; ++X)
+					{
+						const FColor C = Row[X];
+						R += (uint32)C.R * C.A;
+						G += (uint32)C.G * C.A;
+						B += (uint32)C.B * C.A;
+						A += C.A;
+					}
+				}
+
+				const uint64 Count = (uint64)(X1 - X0) * (Y1 - Y0);
+				FColor& Out = OutPixels[(int64)DY * DstSize.X + DX];
+				Out.R = A > 0 ? (uint8)(R / A) : 0;
+				Out.G = A > 0 ? (uint8)(G / A) : 0;
+				Out.B = A > 0 ? (uint8)(B / A) : 0;
+				Out.A = (uint8)(A / Count);
+			}
+		}
+	}
+
+	FIntPoint FitWithin(FIntPoint Size, int32 MaxEdge)
+	{
+		const int32 Longest = FMath::Max(Size.X, Size.Y);
+		if(Longest <= MaxEdge || Longest <= 0)
+		{
+			return Size;
+		}
+		return FIntPoint(
+			FMath::Max(1, (int32)((int64)Size.X * MaxEdge / Longest)),
+			FMath::Max(1, (int32)((int64)Size.Y * MaxEdge / Longest))
+		);
+	}
+
+}
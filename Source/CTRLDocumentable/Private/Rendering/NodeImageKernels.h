@@ -0,0 +1,35 @@
+// This Source Code Form is subject to the terms of the Mozilla Public
+// License, v. 2.0. If a copy of the MPL was not distributed with this
+// file, You can obtain one at http://mozilla.org/MPL/2.0/.
+
+// Copyright (C) 2023-2025 NTY.studio. All Rights Reserved.
+
+#pragma once
+
+#include "CoreMinimal.h"
+
+
+namespace CTRLDocumentable::NodeImage
+{
+
+	/**
+	 * Multiply the alpha of every pixel by AlphaMultiplier (saturating at 255) and, in the same pass,
+	 * compute the tight bounding rect of all pixels that are not fully transparent afterwards.
+	 * Returns an empty rect if the whole image is transparent.
+	 * Multipliers are clamped to [0, 128].
+	 */
+	FIntRect MultiplyAlphaAndComputeBounds(FColor* Pixels, FIntPoint Size, float AlphaMultiplier);
+
+	/** Copy the pixels inside Rect out of a Size-sized image. */
+	void CropPixels(const FColor* Pixels, FIntPoint Size, FIntRect const& Rect, TArray64< FColor >& OutPixels);
+
+	/**
+	 * Box-filter a Size-sized image down to DstSize (each axis no larger than the source).
+	 * Colour is weighted by alpha so transparent margins don't darken the edges.
+	 */
+	void Downscale(const FColor* Pixels, FIntPoint Size, FIntPoint DstSize, TArray64< FColor >& OutPixels);
+
+	/** Largest size with the same aspect ratio as Size whose longer edge is at most MaxEdge, never upscaled. */
+	FIntPoint FitWithin(FIntPoint Size, int32 MaxEdge);
+
+}
@@ -0,0 +1,324 @@
+// This Source Code Form is subject to the terms of the Mozilla Public
+// License, v. 2.0. If a copy of the MPL was not distributed with this
+// file, You can obtain one at http://mozilla.org/MPL/2.0/.
+
+// Copyright (C) 2023-2025 NTY.studio. All Rights Reserved.
+
+#include "NodeImageRenderer.h"
+#include "ShelfPacker.h"
+#include "CTRLDocumentableLog.h"
+#include "Widgets/SCanvas.h"
+#include "Slate/WidgetRenderer.h"
+#include "Engine/TextureRenderTarget2D.h"
+#include "TextureResource.h"
+#include "RenderingThread.h"
+#include "RHIGPUReadback.h"
+#include "RHICommandList.h"
+
+
+FNodeImageRenderer::FNodeImageRenderer(FVector2D InDrawSize, FIntPoint InAtlasSize, int32 InMaxInFlight)
+{
+	DrawSize = InDrawSize;
+	AtlasSize = InAtlasSize;
+	MaxInFlight = FMath::Max(1, InMaxInFlight);
+
+	ReadbackEvent = FPlatformProcess::GetSynchEventFromPool(false);
+	TickHandle = FTSTicker::GetCoreTicker().AddTicker(FTickerDelegate::CreateRaw(this, &FNodeImageRenderer::GT_Tick));
+}
+
+FNodeImageRenderer::~FNodeImageRenderer()
+{
+	ensureMsgf(Slots.Num() == 0, TEXT("FNodeImageRenderer destroyed without GT_Release."));
+
+	FTSTicker::GetCoreTicker().RemoveTicker(TickHandle);
+	FPlatformProcess::ReturnSynchEventToPool(ReadbackEvent);
+}
+
+bool FNodeImageRenderer::GT_Tick(float DeltaTime)
+{
+	GT_Poll();
+	return true;
+}
+
+FNodeImageRenderer::FReadbackSlot* FNodeImageRenderer::GT_AcquireSlot(FVector2D TargetSize)
+{
+	FScopeLock Lock(&SlotsLock);
+
+	// Prefer a free slot whose target already has the right size, otherwise resize any free one.
+	FReadbackSlot* FreeSlot = nullptr;
+	for(auto& Slot : Slots)
+	{
+		if(Slot->State == ESlotState::Free)
+		{
+			if(Slot->TargetSize == TargetSize)
+			{
+				return Slot.Get();
+			}
+			FreeSlot = FreeSlot ? FreeSlot : Slot.Get();
+		}
+	}
+
+	const bool bUseGammaCorrection = true;
+
+	if(FreeSlot == nullptr)
+	{
+		if(Slots.Num() >= MaxInFlight)
+		{
+			return nullptr;
+		}
+
+		// Grow the pool, each slot keeps its render target and readback buffer for reuse.
+		auto NewSlot = MakeUnique< FReadbackSlot >();
+		NewSlot->WidgetRenderer = MakeUnique< FWidgetRenderer >(bUseGammaCorrection);
+		NewSlot->WidgetRenderer->SetIsPrepassNeeded(true);
+		NewSlot->Readback = MakeUnique< FRHIGPUTextureReadback >(TEXT("CTRLDocumentableNodeReadback"));
+		FreeSlot = Slots.Add_GetRef(MoveTemp(NewSlot)).Get();
+	}
+
+	FreeSlot->RenderTarget.Reset(FWidgetRenderer::CreateTargetFor(TargetSize, TF_Bilinear, bUseGammaCorrection));
+	FreeSlot->TargetSize = TargetSize;
+
+	return FreeSlot;
+}
+
+bool FNodeImageRenderer::GT_Submit(TSharedRef< SWidget > const& Widget, FOnImageReadback&& OnReadback)
+{
+	return GT_DrawAndEnqueue(Widget, DrawSize, TOptional< FIntPoint >(), MoveTemp(OnReadback));
+}
+
+int32 FNodeImageRenderer::GT_SubmitAtlas(TArrayView< const TSharedRef< SWidget > > Widgets, TArray< FIntRect >& OutRects, FOnAtlasReadback&& OnReadback)
+{
+	check(IsInGameThread());
+
+	OutRects.Reset();
+	if(Widgets.Num() == 0 || !HasFreeSlot())
+	{
+		return 0;
+	}
+
+	// Node widgets only know their size after a prepass
+	TArray< FIntPoint > Sizes;
+	Sizes.Reserve(Widgets.Num());
+	for(auto const& Widget : Widgets)
+	{
+		Widget->SlatePrepass(1.0f);
+		const FVector2D Desired = Widget->GetDesiredSize();
+		Sizes.Add(FIntPoint(FMath::CeilToInt(Desired.X), FMath::CeilToInt(Desired.Y)));
+	}
+
+	// Padding keeps bilinear filtering and drop shadows from bleeding between neighbours.
+	const int32 Padding = 4;
+	FIntPoint UsedExtent;
+	const int32 Placed = CTRLDocumentable::PackShelves(Sizes, AtlasSize, Padding, OutRects, UsedExtent);
+	if(Placed == 0)
+	{
+		return 0;
+	}
+
+	TSharedRef< SCanvas > Canvas = SNew(SCanvas);
+	for(int32 Idx = 0; Idx < Widgets.Num(); ++Idx)
+	{
+		FIntRect const& Rect = OutRects[Idx];
+		if(Rect.Area() > 0)
+		{
+			Canvas->AddSlot()
+				.Position(FVector2D(Rect.Min))
+				.Size(FVector2D(Rect.Size()))
+				[
+					Widgets[Idx]
+				];
+		}
+	}
+
+	auto OnAtlasReadback = [Rects = OutRects, OnReadback = MoveTemp(OnReadback)](TArray64< FColor >&& Pixels, FIntPoint Size) mutable
+	{
+		OnReadback(MoveTemp(Pixels), Size, Rects);
+	};
+
+	if(!GT_DrawAndEnqueue(Canvas, FVector2D(AtlasSize), UsedExtent, MoveTemp(OnAtlasReadback)))
+	{
+		OutRects.Reset();
+		return 0;
+	}
+
+	return Placed;
+}
+
+bool FNodeImageRenderer::GT_DrawAndEnqueue(TSharedRef< SWidget > const& Widget, FVector2D TargetSize, TOptional< FIntPoint > ReadSize, FOnImageReadback&& OnReadback)
+{
+	check(IsInGameThread());
+
+	FReadbackSlot* Slot = GT_AcquireSlot(TargetSize);
+	if(Slot == nullptr)
+	{
+		return false;
+	}
+
+	// Deferred update, so the widget renderer enqueues its draw without flushing the render thread.
+	const bool bDeferRenderTargetUpdate = true;
+	Slot->WidgetRenderer->DrawWidget(Slot->RenderTarget.Get(), Widget, TargetSize, 0.0f, bDeferRenderTargetUpdate);
+
+	const FVector2D Desired = ReadSize.IsSet() ? FVector2D(ReadSize.GetValue()) : Widget->GetDesiredSize();
+	const FIntPoint Size(
+		FMath::Clamp((int32)Desired.X, 1, (int32)TargetSize.X),
+		FMath::Clamp((int32)Desired.Y, 1, (int32)TargetSize.Y)
+	);
+
+	{
+		FScopeLock Lock(&SlotsLock);
+		Slot->Widget = Widget;
+		Slot->Size = Size;
+		Slot->OnReadback = MoveTemp(OnReadback);
+		Slot->bCopied = false;
+		Slot->bPollQueued = false;
+		Slot->State = ESlotState::InFlight;
+	}
+
+	FTextureRenderTargetResource* RTResource = Slot->RenderTarget->GameThread_GetRenderTargetResource();
+	FRHIGPUTextureReadback* Readback = Slot->Readback.Get();
+	ENQUEUE_RENDER_COMMAND(CTRLDocumentableEnqueueNodeReadback)(
+		[RTResource, Readback, Size](FRHICommandListImmediate& RHICmdList)
+		{
+			FRHITexture* Texture = RTResource->GetRenderTargetTexture();
+			RHICmdList.Transition(FRHITransitionInfo(Texture, ERHIAccess::Unknown, ERHIAccess::CopySrc));
+			Readback->EnqueueCopy(RHICmdList, Texture, FResolveRect(0, 0, Size.X, Size.Y));
+			RHICmdList.Transition(FRHITransitionInfo(Texture, ERHIAccess::CopySrc, ERHIAccess::SRVMask));
+		});
+
+	return true;
+}
+
+void FNodeImageRenderer::GT_Poll()
+{
+	check(IsInGameThread());
+
+	FScopeLock Lock(&SlotsLock);
+
+	for(auto& SlotPtr : Slots)
+	{
+		FReadbackSlot* Slot = SlotPtr.Get();
+		if(Slot->State != ESlotState::InFlight || Slot->bCopied || Slot->bPollQueued.exchange(true))
+		{
+			continue;
+		}
+
+		// Readiness has to be checked on the render thread, where the copy is also made once the fence has passed.
+		ENQUEUE_RENDER_COMMAND(CTRLDocumentablePollNodeReadback)(
+			[Slot, Event = ReadbackEvent](FRHICommandListImmediate& RHICmdList)
+			{
+				if(Slot->Readback->IsReady())
+				{
+					int32 RowPitchInPixels = 0;
+					const FColor* Data = static_cast< const FColor* >(Slot->Readback->Lock(RowPitchInPixels));
+
+					Slot->Pixels.SetNumUninitialized((int64)Slot->Size.X * Slot->Size.Y);
+					for(int32 Y = 0; Y < Slot->Size.Y; ++Y)
+					{
+						FMemory::Memcpy(Slot->Pixels.GetData() + (int64)Y * Slot->Size.X, Data + (int64)Y * RowPitchInPixels, Slot->Size.X * sizeof(FColor));
+					}
+
+					Slot->Readback->Unlock();
+					Slot->bCopied = true;
+				}
+
+				Slot->bPollQueued = false;
+				if(Slot->bCopied)
+				{
+					Event->Trigger();
+				}
+			});
+	}
+}
+
+bool FNodeImageRenderer::WaitForReadback(uint32 TimeoutMs)
+{
+	return ReadbackEvent->Wait(TimeoutMs);
+}
+
+int32 FNodeImageRenderer::DispatchCompleted()
+{
+	TArray< TPair< FOnImageReadback, TPair< TArray64< FColor >, FIntPoint > > > Completed;
+	int32 StillInFlight = 0;
+
+	{
+		FScopeLock Lock(&SlotsLock);
+
+		for(auto& Slot : Slots)
+		{
+			if(Slot->State != ESlotState::InFlight)
+			{
+				continue;
+			}
+
+			if(!Slot->bCopied || Slot->bPollQueued)
+			{
+				++StillInFlight;
+				continue;
+			}
+
+			Completed.Emplace(MoveTemp(Slot->OnReadback), TPair< TArray64< FColor >, FIntPoint >(MoveTemp(Slot->Pixels), Slot->Size));
+			Slot->Widget.Reset();
+			Slot->State = ESlotState::Free;
+		}
+	}
+
+	// Run the callbacks outside of the lock, they are free to do heavy work.
+	for(auto& Entry : Completed)
+	{
+		Entry.Key(MoveTemp(Entry.Value.Key), Entry.Value.Value);
+	}
+
+	return StillInFlight;
+}
+
+bool FNodeImageRenderer::HasFreeSlot() const
+{
+	FScopeLock Lock(&SlotsLock);
+
+	if(Slots.Num() < MaxInFlight)
+	{
+		return true;
+	}
+
+	for(auto const& Slot : Slots)
+	{
+		if(Slot->State == ESlotState::Free)
+		{
+			return true;
+		}
+	}
+	return false;
+}
+
+int32 FNodeImageRenderer::NumInFlight() const
+{
+	FScopeLock Lock(&SlotsLock);
+
+	int32 Count = 0;
+	for(auto const& Slot : Slots)
+	{
+		Count += Slot->State != ESlotState::Free ? 1 : 0;
+	}
+	return Count;
+}
+
+void FNodeImageRenderer::GT_Release()
+{
+	check(IsInGameThread());
+
+	FTSTicker::GetCoreTicker().RemoveTicker(TickHandle);
+	TickHandle.Reset();
+
+	// Make sure no queued render command still references a slot we're about to destroy.
+	FlushRenderingCommands();
+
+	FScopeLock Lock(&SlotsLock);
+	for(auto& Slot : Slots)
+	{
+		if(Slot->State != ESlotState::Free)
+		{
+			UE_LOG(LogCTRLDocumentable, Warning, TEXT("Discarding node image readback that never completed."));
+		}
+	}
+	Slots.Empty();
+}
@@ -0,0 +1,90 @@
+// This Source Code Form is subject to the terms of the Mozilla Public
+// License, v. 2.0. If a copy of the MPL was not distributed with this
+// file, You can obtain one at http://mozilla.org/MPL/2.0/.
+
+// Copyright (C) 2023-2025 NTY.studio. All Rights Reserved.
+
+#pragma once
+
+#include "CoreMinimal.h"
+#include "UObject/StrongObjectPtr.h"
+#include "Containers/Ticker.h"
+#include <atomic>
+
+
+class SWidget;
+class FWidgetRenderer;
+class FRHIGPUTextureReadback;
+class UTextureRenderTarget2D;
+
+/**
+ * Renders node widgets into pooled render targets and reads them back through queued GPU readbacks.
+ * Nothing here ever flushes rendering commands: a submitted widget is polled from the game thread's tick
+ * over the following frames and handed back once the copy has landed, so several nodes can be in flight at once.
+ * Batches of widgets can also be packed into a single atlas target, drawn in one pass and read back once.
+ * GT_Release must be called before destruction.
+ */
+class FNodeImageRenderer
+{
+public:
+	typedef TUniqueFunction< void(TArray64< FColor >&& Pixels, FIntPoint Size) > FOnImageReadback;
+	typedef TUniqueFunction< void(TArray64< FColor >&& Pixels, FIntPoint Size, TArray< FIntRect > const& Rects) > FOnAtlasReadback;
+
+	FNodeImageRenderer(FVector2D InDrawSize, FIntPoint InAtlasSize, int32 InMaxInFlight);
+	~FNodeImageRenderer();
+
+public:
+	/** Callable only from game thread */
+	bool GT_Submit(TSharedRef< SWidget > const& Widget, FOnImageReadback&& OnReadback);
+	int32 GT_SubmitAtlas(TArrayView< const TSharedRef< SWidget > > Widgets, TArray< FIntRect >& OutRects, FOnAtlasReadback&& OnReadback);
+	void GT_Poll();
+	void GT_Release();
+	/**/
+
+	/** Callable from background thread */
+	/** Blocks until a readback has landed since the last wait, or the timeout passes. False on timeout. */
+	bool WaitForReadback(uint32 TimeoutMs);
+	int32 DispatchCompleted();
+	bool HasFreeSlot() const;
+	int32 NumInFlight() const;
+	/**/
+
+protected:
+	enum class ESlotState : uint8
+	{
+		Free,
+		InFlight,
+	};
+
+	struct FReadbackSlot
+	{
+		TStrongObjectPtr< UTextureRenderTarget2D > RenderTarget;
+		TUniquePtr< FWidgetRenderer > WidgetRenderer;
+		TUniquePtr< FRHIGPUTextureReadback > Readback;
+		TSharedPtr< SWidget > Widget;
+		FVector2D TargetSize = FVector2D::ZeroVector;
+		FIntPoint Size = FIntPoint::ZeroValue;
+		FOnImageReadback OnReadback;
+		TArray64< FColor > Pixels;
+
+		ESlotState State = ESlotState::Free;
+		std::atomic< bool > bPollQueued { false };
+		std::atomic< bool > bCopied { false };
+	};
+
+	bool GT_Tick(float DeltaTime);
+	FReadbackSlot* GT_AcquireSlot(FVector2D TargetSize);
+	bool GT_DrawAndEnqueue(TSharedRef< SWidget > const& Widget, FVector2D TargetSize, TOptional< FIntPoint > ReadSize, FOnImageReadback&& OnReadback);
+
+protected:
+	TArray< TUniquePtr< FReadbackSlot > > Slots;
+	mutable FCriticalSection SlotsLock;
+
+	/** Triggered on the render thread each time a copy lands */
+	FEvent* ReadbackEvent = nullptr;
+	FTSTicker::FDelegateHandle TickHandle;
+
+	FVector2D DrawSize;
+	FIntPoint AtlasSize;
+	int32 MaxInFlight;
+};
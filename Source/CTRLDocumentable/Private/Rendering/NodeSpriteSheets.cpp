@@ -0,0 +1,106 @@
+// This Source Code Form is subject to the terms of the Mozilla Public
+// License, v. 2.0. If a copy of the MPL was not distributed with this
+// file, You can obtain one at http://mozilla.org/MPL/2.0/.
+
+// Copyright (C) 2023-2025 NTY.studio. All Rights Reserved.
+
+#include "NodeSpriteSheets.h"
+#include "NodeImageIO.h"
+#include "ShelfPacker.h"
+#include "CTRLDocumentableLog.h"
+
+
+FNodeSpriteSheetBuilder::FNodeSpriteSheetBuilder(FIntPoint InMaxSheetSize, ENodeImageEncoder InEncoder)
+{
+	MaxSheetSize = InMaxSheetSize;
+	Encoder = InEncoder;
+}
+
+void FNodeSpriteSheetBuilder::Add(FString const& ClassDir, FString const& ImageKey, TArray64< FColor >&& Pixels, FIntPoint Size)
+{
+	FScopeLock ScopeLock(&Lock);
+
+	Classes.FindOrAdd(ClassDir).Pending.Add(FSprite{ ImageKey, MoveTemp(Pixels), Size });
+}
+
+void FNodeSpriteSheetBuilder::Flush(TMap< FString, FPlacement >& OutPlacements)
+{
+	FScopeLock ScopeLock(&Lock);
+
+	for(auto& Entry : Classes)
+	{
+		if(Entry.Value.Pending.Num() > 0)
+		{
+			PackClass(Entry.Key, Entry.Value, OutPlacements);
+		}
+	}
+}
+
+void FNodeSpriteSheetBuilder::PackClass(FString const& ClassDir, FClassSheets& Sheets, TMap< FString, FPlacement >& OutPlacements)
+{
+	// A single pixel gap is enough, sprites are already trimmed and drawn unfiltered by the viewer.
+	const int32 Padding = 1;
+
+	TArray< FSprite > Remaining = MoveTemp(Sheets.Pending);
+	while(Remaining.Num() > 0)
+	{
+		TArray< FIntPoint > Sizes;
+		Sizes.Reserve(Remaining.Num());
+		for(auto const& Sprite : Remaining)
+		{
+			Sizes.Add(Sprite.Size);
+		}
+
+		TArray< FIntRect > Rects;
+		FIntPoint UsedExtent;
+		const int32 Placed = CTRLDocumentable::PackShelves(Sizes, MaxSheetSize, Padding, Rects, UsedExtent);
+
+		if(Placed == 0)
+		{
+			// Only oversized sprites left, they can't go on any sheet and are written on their own where the node expects them
+			for(auto& Sprite : Remaining)
+			{
+				if(!CTRLDocumentable::NodeImage::SavePng(MoveTemp(Sprite.Pixels), Sprite.Size, Sprite.ImageKey, Encoder))
+				{
+					UE_LOG(LogCTRLDocumentable, Warning, TEXT("Failed to save node image too large for a sprite sheet: %s"), *Sprite.ImageKey);
+				}
+			}
+			break;
+		}
+
+		const FString SheetFilename = FString::Printf(TEXT("nd_sheet_%d.png"), Sheets.NextSheetIndex++);
+
+		TArray64< FColor > SheetPixels;
+		SheetPixels.SetNumZeroed((int64)UsedExtent.X * UsedExtent.Y);
+
+		TArray< FSprite > Unplaced;
+		for(int32 Idx = 0; Idx < Remaining.Num(); ++Idx)
+		{
+			FIntRect const& Rect = Rects[Idx];
+			if(Rect.Area() <= 0)
+			{
+				Unplaced.Add(MoveTemp(Remaining[Idx]));
+				continue;
+			}
+
+			FSprite const& Sprite = Remaining[Idx];
+			for(int32 Y = 0; Y < Sprite.Size.Y; ++Y)
+			{
+				FMemory::Memcpy(
+					SheetPixels.GetData() + (int64)(Rect.Min.Y + Y) * UsedExtent.X + Rect.Min.X,
+					Sprite.Pixels.GetData() + (int64)Y * Sprite.Size.X,
+					Sprite.Size.X * sizeof(FColor)
+				);
+			}
+
+			OutPlacements.Add(Sprite.ImageKey, FPlacement{ SheetFilename, UsedExtent, Rect });
+		}
+
+		if(!CTRLDocumentable::NodeImage::SavePng(MoveTemp(SheetPixels), UsedExtent, ClassDir / SheetFilename, Encoder))
+		{
+			UE_LOG(LogCTRLDocumentable, Warning, TEXT("Failed to save node sprite sheet: %s"), *(ClassDir / SheetFilename));
+		}
+
+		Remaining = MoveTemp(Unplaced);
+	}
+}
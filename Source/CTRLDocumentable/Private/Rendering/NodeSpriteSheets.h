@@ -0,0 +1,62 @@
+// This Source Code Form is subject to the terms of the Mozilla Public
+// License, v. 2.0. If a copy of the MPL was not distributed with this
+// file, You can obtain one at http://mozilla.org/MPL/2.0/.
+
+// Copyright (C) 2023-2025 NTY.studio. All Rights Reserved.
+
+#pragma once
+
+#include "CoreMinimal.h"
+#include "GenerationSettings.h"
+
+
+/**
+ * Collects finished node images per class directory and packs them into a few large sheets,
+ * so the viewer loads one image per class page instead of one per node.
+ */
+class FNodeSpriteSheetBuilder
+{
+public:
+	struct FPlacement
+	{
+		/** Sheet file name, relative to the class image directory. */
+		FString SheetFilename;
+		FIntPoint SheetSize;
+		FIntRect Rect;
+	};
+
+	FNodeSpriteSheetBuilder(FIntPoint InMaxSheetSize, ENodeImageEncoder InEncoder);
+
+public:
+	/**
+	 * Thread safe. ImageKey identifies the node image in the placements handed out by Flush.
+	 * It's also the path the image is written to on its own if it is too large for a sheet, and then gets no placement.
+	 */
+	void Add(FString const& ClassDir, FString const& ImageKey, TArray64< FColor >&& Pixels, FIntPoint Size);
+
+	/** Pack and write everything added so far. New sheets are appended, earlier sheets are never rewritten. Meant for when the images are all in, not per batch. */
+	void Flush(TMap< FString, FPlacement >& OutPlacements);
+
+protected:
+	struct FSprite
+	{
+		FString ImageKey;
+		TArray64< FColor > Pixels;
+		FIntPoint Size;
+	};
+
+	struct FClassSheets
+	{
+		TArray< FSprite > Pending;
+		int32 NextSheetIndex = 0;
+	};
+
+	void PackClass(FString const& ClassDir, FClassSheets& Sheets, TMap< FString, FPlacement >& OutPlacements);
+
+protected:
+	TMap< FString, FClassSheets > Classes;
+	FCriticalSection Lock;
+
+	FIntPoint MaxSheetSize;
+	ENodeImageEncoder Encoder;
+};
@@ -0,0 +1,73 @@
+// This Source Code Form is subject to the terms of the Mozilla Public
+// License, v. 2.0. If a copy of the MPL was not distributed with this
+// file, You can obtain one at http://mozilla.org/MPL/2.0/.
+
+// Copyright (C) 2023-2025 NTY.studio. All Rights Reserved.
+
+#pragma once
+
+#include "CoreMinimal.h"
+
+
+namespace CTRLDocumentable
+{
+
+	/**
+	 * Packs rectangles into rows ("shelves") of a fixed-size page, tallest first.
+	 * OutRects receives one rect per input size; rects that did not fit are left empty.
+	 * Returns the number of rects placed and the extent of the page actually used.
+	 */
+	inline int32 PackShelves(TArrayView< const FIntPoint > Sizes, FIntPoint PageSize, int32 Padding, TArray< FIntRect >& OutRects, FIntPoint& OutUsedExtent)
+	{
+		OutRects.SetNum(Sizes.Num());
+		OutUsedExtent = FIntPoint::ZeroValue;
+
+		TArray< int32 > Order;
+		Order.Reserve(Sizes.Num());
+		for(int32 Idx = 0; Idx < Sizes.Num(); ++Idx)
+		{
+			OutRects[Idx] = FIntRect();
+			Order.Add(Idx);
+		}
+		Order.StableSort([&Sizes](int32 A, int32 B)
+		{
+			return Sizes[A].Y > Sizes[B].Y;
+		});
+
+		int32 Placed = 0;
+		FIntPoint Cursor = FIntPoint::ZeroValue;
+		int32 ShelfHeight = 0;
+
+		for(int32 Idx : Order)
+		{
+			const FIntPoint Size = Sizes[Idx];
+			if(Size.X <= 0 || Size.Y <= 0 || Size.X > PageSize.X || Size.Y > PageSize.Y)
+			{
+				continue;
+			}
+
+			// Start a new shelf when this one is full
+			if(Cursor.X + Size.X > PageSize.X)
+			{
+				Cursor.X = 0;
+				Cursor.Y += ShelfHeight + Padding;
+				ShelfHeight = 0;
+			}
+			if(Cursor.Y + Size.Y > PageSize.Y)
+			{
+				continue;
+			}
+
+			OutRects[Idx] = FIntRect(Cursor, Cursor + Size);
+			OutUsedExtent.X = FMath::Max(OutUsedExtent.X, Cursor.X + Size.X);
+			OutUsedExtent.Y = FMath::Max(OutUsedExtent.Y, Cursor.Y + Size.Y);
+
+			Cursor.X += Size.X + Padding;
+			ShelfHeight = FMath::Max(ShelfHeight, Size.Y);
+			++Placed;
+		}
+
+		return Placed;
+	}
+
+}
@@ -0,0 +1,165 @@
+// This Source Code Form is subject to the terms of the Mozilla Public
+// License, v. 2.0. If a copy of the MPL was not distributed with this
+// file, You can obtain one at http://mozilla.org/MPL/2.0/.
+
+// Copyright (C) 2023-2025 NTY.studio. All Rights Reserved.
+
+#include "SvgNodeRenderer.h"
+#include "EdGraph/EdGraphNode.h"
+#include "EdGraph/EdGraphPin.h"
+#include "EdGraphSchema_K2.h"
+
+
+namespace CTRLDocumentable::NodeSvg
+{
+
+	// Metrics roughly matching the default graph editor style at 1:1 zoom.
+	static constexpr float HeaderHeight = 28.0f;
+	static constexpr float RowHeight = 24.0f;
+	static constexpr float PinInset = 14.0f;
+	static constexpr float LabelOffset = 12.0f;
+	static constexpr float ColumnGap = 32.0f;
+	static constexpr float CornerRadius = 6.0f;
+	static constexpr float BodyCharWidth = 6.8f;
+	static constexpr float TitleCharWidth = 7.6f;
+
+	static FString ToSvgColor(FLinearColor const& Color)
+	{
+		const FColor SRGB = Color.ToFColor(true);
+		return FString::Printf(TEXT("#%02x%02x%02x"), SRGB.R, SRGB.G, SRGB.B);
+	}
+
+	static FString EscapeXml(FString const& In)
+	{
+		FString Out;
+		Out.Reserve(In.Len());
+		for(TCHAR Char : In)
+		{
+			switch(Char)
+			{
+				case TEXT('&'): Out += TEXT("&amp;"); break;
+				case TEXT('<'): Out += TEXT("&lt;"); break;
+				case TEXT('>'): Out += TEXT("&gt;"); break;
+				case TEXT('"'): Out += TEXT("&quot;"); break;
+				default: Out.AppendChar(Char); break;
+			}
+		}
+		return Out;
+	}
+
+	static float EstimateTextWidth(FString const& Text, float CharWidth)
+	{
+		return Text.Len() * CharWidth;
+	}
+
+	FNodeDesc DescribeNode(UEdGraphNode* Node)
+	{
+		FNodeDesc Desc;
+
+		// Only the first line, the rest of a full title is the "Target is ..." style subtitle
+		FString Title = Node->GetNodeTitle(ENodeTitleType::FullTitle).ToString();
+		Title.Split(TEXT("\n"), &Title, nullptr);
+		Desc.Title = Title.TrimEnd();
+		Desc.TitleColor = Node->GetNodeTitleColor();
+
+		auto K2Schema = GetDefault< UEdGraphSchema_K2 >();
+		for(auto Pin : Node->Pins)
+		{
+			if(Pin->bHidden)
+			{
+				continue;
+			}
+
+			FPinDesc PinDesc;
+			PinDesc.bExec = Pin->PinType.PinCategory == UEdGraphSchema_K2::PC_Exec;
+			PinDesc.bContainer = Pin->PinType.IsContainer();
+			PinDesc.Color = K2Schema->GetPinTypeColor(Pin->PinType);
+			PinDesc.Name = Pin->GetDisplayName().ToString();
+
+			(Pin->Direction == EGPD_Input ? Desc.Inputs : Desc.Outputs).Add(MoveTemp(PinDesc));
+		}
+
+		return Desc;
+	}
+
+	static void AppendPin(FString& Svg, FPinDesc const& Pin, float X, float Y, bool bInput)
+	{
+		const FString Color = ToSvgColor(Pin.Color);
+
+		if(Pin.bExec)
+		{
+			Svg += FString::Printf(TEXT("<path d=\"M%.1f %.1f h5 l5 6 l-5 6 h-5 z\" fill=\"none\" stroke=\"%s\" stroke-width=\"1.5\"/>"), X - 5.0f, Y - 6.0f, *Color);
+		}
+		else if(Pin.bContainer)
+		{
+			Svg += FString::Printf(TEXT("<rect x=\"%.1f\" y=\"%.1f\" width=\"10\" height=\"10\" fill=\"none\" stroke=\"%s\" stroke-width=\"1.5\"/>"), X - 5.0f, Y - 5.0f, *Color);
+		}
+		else
+		{
+			Svg += FString::Printf(TEXT("<circle cx=\"%.1f\" cy=\"%.1f\" r=\"5\" fill=\"none\" stroke=\"%s\" stroke-width=\"1.5\"/>"), X, Y, *Color);
+		}
+
+		if(!Pin.Name.IsEmpty())
+		{
+			const float TextX = bInput ? X + LabelOffset : X - LabelOffset;
+			Svg += FString::Printf(TEXT("<text x=\"%.1f\" y=\"%.1f\" text-anchor=\"%s\">%s</text>"), TextX, Y + 4.0f, bInput ? TEXT("start") : TEXT("end"), *EscapeXml(Pin.Name));
+		}
+	}
+
+	FString RenderNode(FNodeDesc const& Desc, FIntPoint* OutSize)
+	{
+		float InputColumn = 0.0f;
+		for(auto const& Pin : Desc.Inputs)
+		{
+			InputColumn = FMath::Max(InputColumn, EstimateTextWidth(Pin.Name, BodyCharWidth));
+		}
+		float OutputColumn = 0.0f;
+		for(auto const& Pin : Desc.Outputs)
+		{
+			OutputColumn = FMath::Max(OutputColumn, EstimateTextWidth(Pin.Name, BodyCharWidth));
+		}
+
+		const float BodyWidth = (PinInset + LabelOffset) * 2.0f + InputColumn + OutputColumn + ColumnGap;
+		const float TitleWidth = EstimateTextWidth(Desc.Title, TitleCharWidth) + PinInset * 2.0f;
+		const float Width = FMath::CeilToFloat(FMath::Max(BodyWidth, TitleWidth));
+		const int32 Rows = FMath::Max(Desc.Inputs.Num(), Desc.Outputs.Num());
+		const float Height = HeaderHeight + Rows * RowHeight + 8.0f;
+		if(OutSize)
+		{
+			*OutSize = FIntPoint(FMath::CeilToInt(Width), FMath::CeilToInt(Height));
+		}
+
+		FString Svg;
+		Svg.Reserve(1024 + Rows * 256);
+		Svg += FString::Printf(TEXT("<svg xmlns=\"http://www.w3.org/2000/svg\" width=\"%.0f\" height=\"%.0f\" viewBox=\"0 0 %.0f %.0f\">"), Width, Height, Width, Height);
+		Svg += TEXT("<defs><linearGradient id=\"h\" x1=\"0\" x2=\"1\" y1=\"0\" y2=\"0\">");
+		Svg += FString::Printf(TEXT("<stop offset=\"0\" stop-color=\"%s\"/><stop offset=\"1\" stop-color=\"%s\" stop-opacity=\"0.15\"/>"), *ToSvgColor(Desc.TitleColor), *ToSvgColor(Desc.TitleColor));
+		Svg += TEXT("</linearGradient><clipPath id=\"c\">");
+		Svg += FString::Printf(TEXT("<rect width=\"%.0f\" height=\"%.0f\" rx=\"%.0f\"/>"), Width, Height, CornerRadius);
+		Svg += TEXT("</clipPath></defs>");
+
+		// Body, header band and outline
+		Svg += TEXT("<g clip-path=\"url(#c)\">");
+		Svg += FString::Printf(TEXT("<rect width=\"%.0f\" height=\"%.0f\" fill=\"#0f0f0f\" fill-opacity=\"0.85\"/>"), Width, Height);
+		Svg += FString::Printf(TEXT("<rect width=\"%.0f\" height=\"%.0f\" fill=\"url(#h)\"/>"), Width, HeaderHeight);
+		Svg += TEXT("</g>");
+		Svg += FString::Printf(TEXT("<rect x=\"0.5\" y=\"0.5\" width=\"%.0f\" height=\"%.0f\" rx=\"%.0f\" fill=\"none\" stroke=\"#000\" stroke-opacity=\"0.6\"/>"), Width - 1.0f, Height - 1.0f, CornerRadius);
+
+		Svg += TEXT("<g font-family=\"Roboto, 'Segoe UI', Arial, sans-serif\" fill=\"#fff\">");
+		Svg += FString::Printf(TEXT("<text x=\"%.1f\" y=\"18\" font-size=\"13\" font-weight=\"bold\">%s</text>"), PinInset, *EscapeXml(Desc.Title));
+
+		Svg += TEXT("<g font-size=\"11\">");
+		for(int32 Idx = 0; Idx < Desc.Inputs.Num(); ++Idx)
+		{
+			AppendPin(Svg, Desc.Inputs[Idx], PinInset, HeaderHeight + (Idx + 0.5f) * RowHeight + 4.0f, true);
+		}
+		for(int32 Idx = 0; Idx < Desc.Outputs.Num(); ++Idx)
+		{
+			AppendPin(Svg, Desc.Outputs[Idx], Width - PinInset, HeaderHeight + (Idx + 0.5f) * RowHeight + 4.0f, false);
+		}
+		Svg += TEXT("</g></g></svg>");
+
+		return Svg;
+	}
+
+}
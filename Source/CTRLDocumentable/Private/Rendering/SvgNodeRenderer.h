@@ -0,0 +1,40 @@
+// This Source Code Form is subject to the terms of the Mozilla Public
+// License, v. 2.0. If a copy of the MPL was not distributed with this
+// file, You can obtain one at http://mozilla.org/MPL/2.0/.
+
+// Copyright (C) 2023-2025 NTY.studio. All Rights Reserved.
+
+#pragma once
+
+#include "CoreMinimal.h"
+
+
+class UEdGraphNode;
+
+namespace CTRLDocumentable::NodeSvg
+{
+
+	struct FPinDesc
+	{
+		FString Name;
+		FLinearColor Color;
+		bool bExec = false;
+		bool bContainer = false;
+	};
+
+	/** Everything needed to draw a node, captured up front so the drawing itself touches no UObjects. */
+	struct FNodeDesc
+	{
+		FString Title;
+		FLinearColor TitleColor;
+		TArray< FPinDesc > Inputs;
+		TArray< FPinDesc > Outputs;
+	};
+
+	/** Capture the visible title and pins of a K2 node. Safe to call from the processor thread. */
+	FNodeDesc DescribeNode(UEdGraphNode* Node);
+
+	/** Lay out and draw the node as a standalone SVG document. Pure string work, callable from any thread. */
+	FString RenderNode(FNodeDesc const& Desc, FIntPoint* OutSize = nullptr);
+
+}
@@ -0,0 +1,203 @@
+// This Source Code Form is subject to the terms of the Mozilla Public
+// License, v. 2.0. If a copy of the MPL was not distributed with this
+// file, You can obtain one at http://mozilla.org/MPL/2.0/.
+
+// Copyright (C) 2023-2025 NTY.studio. All Rights Reserved.
+
+#include "NodeImageServer.h"
+#include "CTRLDocumentableLog.h"
+#include "DocumentationGenerator.h"
+#include "BlueprintNodeSpawner.h"
+#include "HttpServerModule.h"
+#include "HttpServerResponse.h"
+#include "HttpServerRequest.h"
+#include "IHttpRouter.h"
+#include "Async/Async.h"
+#include "Misc/FileHelper.h"
+
+
+FNodeImageServer::FNodeImageServer(FGenerationSettings const& InSettings)
+{
+	Settings = InSettings;
+	Port = InSettings.NodeImageServerPort;
+
+	// The server's own generator draws each image straight to its final file
+	Settings.NodeImageFormat = ENodeImageFormat::Raster;
+	Settings.bRenderNodeImagesOnDemand = false;
+	Settings.bPackNodeSpriteSheets = false;
+	Settings.bBatchNodeImages = false;
+	Settings.AdditionalContextClasses.Reset();
+}
+
+FNodeImageServer::~FNodeImageServer()
+{
+	GT_Stop();
+}
+
+bool FNodeImageServer::GT_Start()
+{
+	Generator = MakeUnique< FDocumentationGenerator >();
+	if(!Generator->GT_Init(Settings, FString()))
+	{
+		Generator.Reset();
+		return false;
+	}
+
+	Router = FHttpServerModule::Get().GetHttpRouter(Port);
+	if(!Router.IsValid())
+	{
+		UE_LOG(LogCTRLDocumentable, Warning, TEXT("Failed to open node image server on port %i."), Port);
+		Generator.Reset();
+		return false;
+	}
+
+	RouteHandle = Router->BindRoute(FHttpPath(TEXT("/nodeimg")), EHttpServerRequestVerbs::VERB_GET,
+		FHttpRequestHandler::CreateSP(this, &FNodeImageServer::HandleRequest));
+	FHttpServerModule::Get().StartAllListeners();
+
+	TickHandle = FTSTicker::GetCoreTicker().AddTicker(FTickerDelegate::CreateSP(this, &FNodeImageServer::Tick));
+
+	UE_LOG(LogCTRLDocumentable, Log, TEXT("Serving deferred node images on http://localhost:%i/nodeimg"), Port);
+	return true;
+}
+
+void FNodeImageServer::GT_Stop()
+{
+	if(TickHandle.IsValid())
+	{
+		FTSTicker::GetCoreTicker().RemoveTicker(TickHandle);
+		TickHandle.Reset();
+	}
+
+	if(Router.IsValid())
+	{
+		Router->UnbindRoute(RouteHandle);
+		Router.Reset();
+	}
+
+	for(auto const& Entry : Waiting)
+	{
+		for(auto const& OnComplete : Entry.Value)
+		{
+			OnComplete(FHttpServerResponse::Error(EHttpServerResponseCodes::ServiceUnavail));
+		}
+	}
+	Waiting.Empty();
+	ToRender.Empty();
+
+	// Flushes whatever is still being drawn
+	Generator.Reset();
+}
+
+void FNodeImageServer::Register(FString const& ImageKey, TWeakObjectPtr< UBlueprintNodeSpawner > Spawner, TWeakObjectPtr< UObject > SourceObject)
+{
+	FScopeLock ScopeLock(&DeferredLock);
+	Deferred.Add(ImageKey, FDeferredNodeImage{ Spawner, SourceObject });
+}
+
+bool FNodeImageServer::HandleRequest(FHttpServerRequest const& Request, FHttpResultCallback const& OnComplete)
+{
+	const FString* ImageKey = Request.QueryParams.Find(TEXT("key"));
+	if(!ImageKey)
+	{
+		OnComplete(FHttpServerResponse::Error(EHttpServerResponseCodes::BadRequest));
+		return true;
+	}
+
+	// Only registered keys are served, so the key can't be used to reach outside the image folder
+	{
+		FScopeLock ScopeLock(&DeferredLock);
+		if(!Deferred.Contains(*ImageKey))
+		{
+			OnComplete(FHttpServerResponse::Error(EHttpServerResponseCodes::NotFound));
+			return true;
+		}
+	}
+
+	// Already drawn by an earlier request
+	TArray< uint8 > Png;
+	if(FFileHelper::LoadFileToArray(Png, *(FDocumentationGenerator::GetImageRootDir() / *ImageKey), FILEREAD_Silent))
+	{
+		OnComplete(FHttpServerResponse::Create(MoveTemp(Png), TEXT("image/png")));
+		return true;
+	}
+
+	TArray< FHttpResultCallback >& Callbacks = Waiting.FindOrAdd(*ImageKey);
+	if(Callbacks.Num() == 0)
+	{
+		ToRender.Add(*ImageKey);
+	}
+	Callbacks.Add(OnComplete);
+	return true;
+}
+
+bool FNodeImageServer::Tick(float DeltaTime)
+{
+	if(!Generator.IsValid())
+	{
+		return true;
+	}
+
+	Generator->GT_PumpNodeImages();
+
+	while(ToRender.Num() > 0 && Generator->GT_HasFreeImageSlot())
+	{
+		const FString ImageKey = ToRender[0];
+		ToRender.RemoveAt(0);
+
+		FDeferredNodeImage Entry;
+		{
+			FScopeLock ScopeLock(&DeferredLock);
+			Entry = Deferred.FindRef(ImageKey);
+		}
+
+		if(!Entry.Spawner.IsValid() || !Entry.SourceObject.IsValid())
+		{
+			UE_LOG(LogCTRLDocumentable, Warning, TEXT("Deferred node image expired: %s"), *ImageKey);
+			Respond(ImageKey, TArray< uint8 >());
+			continue;
+		}
+
+		TWeakPtr< FNodeImageServer > WeakThis = AsShared();
+		auto OnDone = [WeakThis, ImageKey](TArray< uint8 >&& Png)
+		{
+			// Encoded on a worker, the HTTP side is only touched from the game thread
+			AsyncTask(ENamedThreads::GameThread, [WeakThis, ImageKey, Png = MoveTemp(Png)]
+			{
+				if(auto This = WeakThis.Pin())
+				{
+					This->Respond(ImageKey, Png);
+				}
+			});
+		};
+
+		const FString Filename = FDocumentationGenerator::GetImageRootDir() / ImageKey;
+		if(!Generator->GT_RenderNodeImage(Entry.Spawner.Get(), Entry.SourceObject.Get(), Filename, MoveTemp(OnDone)))
+		{
+			Respond(ImageKey, TArray< uint8 >());
+		}
+	}
+
+	return true;
+}
+
+void FNodeImageServer::Respond(FString const& ImageKey, TArray< uint8 > const& Png)
+{
+	TArray< FHttpResultCallback > Callbacks;
+	if(!Waiting.RemoveAndCopyValue(ImageKey, Callbacks))
+	{
+		return;
+	}
+
+	for(auto const& OnComplete : Callbacks)
+	{
+		if(Png.Num() > 0)
+		{
+			OnComplete(FHttpServerResponse::Create(TArray< uint8 >(Png), TEXT("image/png")));
+		}
+		else
+		{
+			OnComplete(FHttpServerResponse::Error(EHttpServerResponseCodes::NotFound));
+		}
+	}
+}
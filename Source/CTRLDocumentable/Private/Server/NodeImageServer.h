@@ -0,0 +1,71 @@
+// This Source Code Form is subject to the terms of the Mozilla Public
+// License, v. 2.0. If a copy of the MPL was not distributed with this
+// file, You can obtain one at http://mozilla.org/MPL/2.0/.
+
+// Copyright (C) 2023-2025 NTY.studio. All Rights Reserved.
+
+#pragma once
+
+#include "CoreMinimal.h"
+#include "GenerationSettings.h"
+#include "HttpRouteHandle.h"
+#include "HttpResultCallback.h"
+#include "Containers/Ticker.h"
+
+
+class IHttpRouter;
+class UBlueprintNodeSpawner;
+class FDocumentationGenerator;
+struct FHttpServerRequest;
+
+/**
+ * Local HTTP endpoint that draws deferred node images the first time the viewer asks for them.
+ * Generation only registers how to re-create each node; the image is rendered on request, written
+ * to where a normal run would have put it and served from there afterwards.
+ * Registrations live as long as the editor session that generated the docs.
+ */
+class FNodeImageServer : public TSharedFromThis< FNodeImageServer >
+{
+public:
+	FNodeImageServer(FGenerationSettings const& InSettings);
+	~FNodeImageServer();
+
+public:
+	/** Callable only from game thread */
+	bool GT_Start();
+	void GT_Stop();
+	/**/
+
+	/** Thread safe. ImageKey is the image path relative to the image root, e.g. "KismetSystemLibrary/nd_img_Delay.png". */
+	void Register(FString const& ImageKey, TWeakObjectPtr< UBlueprintNodeSpawner > Spawner, TWeakObjectPtr< UObject > SourceObject);
+
+	int32 GetPort() const { return Port; }
+
+protected:
+	bool HandleRequest(FHttpServerRequest const& Request, FHttpResultCallback const& OnComplete);
+	bool Tick(float DeltaTime);
+	void Respond(FString const& ImageKey, TArray< uint8 > const& Png);
+
+protected:
+	struct FDeferredNodeImage
+	{
+		TWeakObjectPtr< UBlueprintNodeSpawner > Spawner;
+		TWeakObjectPtr< UObject > SourceObject;
+	};
+
+	TMap< FString, FDeferredNodeImage > Deferred;
+	FCriticalSection DeferredLock;
+
+	/** Game thread only: requests waiting for their image, and the keys still to be drawn. */
+	TMap< FString, TArray< FHttpResultCallback > > Waiting;
+	TArray< FString > ToRender;
+
+	/** Own generator instance, only used for its graph and renderer. */
+	TUniquePtr< FDocumentationGenerator > Generator;
+	FGenerationSettings Settings;
+	int32 Port;
+
+	TSharedPtr< IHttpRouter > Router;
+	FHttpRouteHandle RouteHandle;
+	FTSTicker::FDelegateHandle TickHandle;
+};
@@ -23,17 +23,44 @@
 #include "HAL/FileManager.h"
 #include "HAL/PlatformProcess.h"
 #include "Kismet2/KismetEditorUtilities.h"
+#include "UObject/UObjectGlobals.h"
+#include "Docs/DocComment.h"
+#include "Docs/FieldTextCache.h"
+#include "Docs/CultureStringTables.h"
+#include "Docs/SearchIndex.h"
+#include "Docs/TypeIndex.h"
+#include "Docs/NavigationTree.h"
+#include "Docs/GeneratedDocumentIndex.h"
+#include "Docs/DocumentCache.h"
 
 
 #define LOCTEXT_NAMESPACE "CTRLDocumentable"
 
-TArray<TSharedPtr<FJsonValue>> FTaskProcessor::Classes;
-
 
 FTaskProcessor::FTaskProcessor()
 {
 	bRunning = false;
 	bTerminationRequest = false;
+	bWarmStateDirty = false;
+
+	ReloadCompleteHandle = FCoreUObjectDelegates::ReloadCompleteDelegate.AddLambda([this](EReloadCompleteReason)
+	{
+		InvalidateWarmState();
+	});
+	ModulesChangedHandle = FModuleManager::Get().OnModulesChanged().AddLambda([this](FName ModuleName, EModuleChangeReason)
+	{
+		// Editor modules load all the time, only the documented ones matter
+		if(UGenerationSettingsObject::Get()->Settings.NativeModules.Contains(ModuleName))
+		{
+			InvalidateWarmState();
+		}
+	});
+}
+
+FTaskProcessor::~FTaskProcessor()
+{
+	FCoreUObjectDelegates::ReloadCompleteDelegate.Remove(ReloadCompleteHandle);
+	FModuleManager::Get().OnModulesChanged().Remove(ModulesChangedHandle);
 }
 
 void FTaskProcessor::QueueTask(FGenerationSettings const& Settings)
@@ -75,9 +102,70 @@ uint32 FTaskProcessor::Run()
 {
 	TSharedPtr< FGenTask > Next;
 
+	while(!bTerminationRequest && Waiting.Dequeue(Next))
+	{
+		ProcessTask(Next);
+	}
+
+	if(bTerminationRequest && DocGen.IsValid())
+	{
+		// Nobody is waiting for the images of a cancelled task
+		DocGen->DiscardNodeImages();
+	}
+
+	return 0;
+}
+
+void FTaskProcessor::GatherNativeClasses(TArray< FName > const& Modules)
+{
+	if(bWarmStateDirty)
+	{
+		// Code was reloaded or modules came and went, nothing cached can be trusted
+		NativeClassIndex.Reset();
+		IndexedModules.Reset();
+		if(DocGen.IsValid())
+		{
+			CTRLDocumentable::RunOnGameThread([this]
+			{
+				DocGen->GT_Invalidate();
+			});
+		}
+		bWarmStateDirty = false;
+	}
+
+	if(IndexedModules != Modules)
+	{
+		BuildNativeClassIndex(Modules);
+	}
+	
+	for(auto const& WeakClass : NativeClassIndex)
+	{
+		UClass* Class = WeakClass.Get();
+		if(Class)
+		{
+			AddClass(Class);
+		}
+	}
+}
+
+void FTaskProcessor::AddClass(UClass* Class)
+{
+	if (!ProcessClass(Class))
+	{
+		return;
+	}
+
+	const int32 Index = SerializeClassInfo(Class, Current->Document);
+
+	// Nodes refer to their class by doc id, which drops the skeleton class decorations
+	Current->ClassIndexById.Add(FDocumentationGenerator::GetClassDocId(Class).ToLower(), Index);
+}
+
+void FTaskProcessor::BuildNativeClassIndex(TArray< FName > const& Modules)
+{
 	TArray<UPackage*> NativePackages;
 	
-	for(auto& Module : UGenerationSettingsObject::Get()->Settings.NativeModules)
+	for(auto& Module : Modules)
 	{
 		FString PackagePath = FString::Printf(TEXT("/Script/%s"), *Module.ToString());
 		if (UPackage* Package = FindPackage(nullptr, *PackagePath))
@@ -85,10 +173,8 @@ uint32 FTaskProcessor::Run()
 			NativePackages.AddUnique(Package);
 		}
 	}
-	
-	
-	//Classes.Empty();
-	
+
+	NativeClassIndex.Reset();
 	for(TObjectIterator< UClass > ClassIt; ClassIt; ++ClassIt)
 	{
 		UClass* Class = *ClassIt;
@@ -117,31 +203,15 @@ uint32 FTaskProcessor::Run()
 			continue;
 		}
 #endif
-		FString ClassName = Class->GetPrefixCPP() + Class->GetName();
-		UE_LOG(LogTemp, Warning, TEXT("Found class: %s"), *ClassName);
-	
-		if (ProcessClass(Class))
-		{
-			Classes.Add(MakeShared<FJsonValueObject>(FJsonValueObject(SerializeClassInfo(Class))));
-		}
-	}
-	
-	FJsonObject* ObjectMeta = new FJsonObject;
-	ObjectMeta->SetArrayField("Classes", Classes);
-	FString JsonString;
-	FJsonSerializer::Serialize(Classes, TJsonWriterFactory<>::Create(&JsonString, 0));
-	FFileHelper::SaveStringToFile(JsonString, *(FPaths::ProjectSavedDir() + "/dump.json"));
-	// Create a read and write pipe for the child process
-	void* PipeRead = nullptr;
-	void* PipeWrite = nullptr;
-	verify(FPlatformProcess::CreatePipe(PipeRead, PipeWrite));
-	
-	while(!bTerminationRequest && Waiting.Dequeue(Next))
-	{
-		ProcessTask(Next);
+		NativeClassIndex.Add(Class);
 	}
 
-	return 0;
+	IndexedModules = Modules;
+}
+
+void FTaskProcessor::InvalidateWarmState()
+{
+	bWarmStateDirty = true;
 }
 
 void FTaskProcessor::Exit()
@@ -159,57 +229,60 @@ void FTaskProcessor::Stop()
 	bTerminationRequest = true;
 }
 
-TArray<TSharedPtr<FJsonValue>> GetClassHierarchy(UClass* Class)
+int32 FTaskProcessor::GetHierarchyIndex(const UClass* Class, FDocModel& Model)
 {
-	TArray<TSharedPtr<FJsonValue>> Output;
-	if (Class)
+	// Walk up only as far as the first ancestor already in the table, then add the rest root first
+	TArray< const UClass*, TInlineAllocator< 16 > > Missing;
+	int32 Parent = INDEX_NONE;
+	for (const UClass* Ancestor = Class; Ancestor; Ancestor = Ancestor->GetSuperClass())
 	{
-		// Traverse the parent classes
-		const UClass* ParentClass = Class->GetSuperClass();
-		while (ParentClass)
+		if (int32 const* Found = Current->HierarchyIndices.Find(Ancestor))
 		{
-			TArray<TSharedPtr<FJsonValue>> Temp;
-			Temp.Add(MakeShared<FJsonValueString>(FJsonValueString(ParentClass->GetPrefixCPP() + ParentClass->GetName())));
-			Temp.Append(Output);
-			Output = Temp;
-			ParentClass = ParentClass->GetSuperClass();
+			Parent = *Found;
+			break;
 		}
+		Missing.Add(Ancestor);
+	}
 
-		return Output;
+	for (int32 Idx = Missing.Num() - 1; Idx >= 0; --Idx)
+	{
+		Parent = Model.AddHierarchyEntry(Model.Intern(Missing[Idx]->GetPrefixCPP() + Missing[Idx]->GetName()), Parent);
+		Current->HierarchyIndices.Add(Missing[Idx], Parent);
 	}
-	return TArray<TSharedPtr<FJsonValue>>();
+	return Parent;
 }
 
 bool FTaskProcessor::ProcessClass(UClass* Class)
 {
 	
-	if (ProcessedClasses.Contains(Class))
+	if (Current->ProcessedClasses.Contains(Class))
 	{
 		return false;
 	}
 
-	ProcessedClasses.Add(Class);
+	Current->ProcessedClasses.Add(Class);
 	
 	return true;
 }
 
-TSharedRef<FJsonObject> FTaskProcessor::SerializeClassInfo(UClass* Class)
+int32 FTaskProcessor::SerializeClassInfo(UClass* Class, FDocModel& Model)
 {
+	FFieldTextCache& Texts = DocGen->GetFieldTexts();
 	const FString ClassName = Class->GetPrefixCPP() + Class->GetName();
 
-	FJsonObject* ClassInfo = new FJsonObject;
-	TArray<TSharedPtr<FJsonValue>> Functions;
-	TArray<TSharedPtr<FJsonValue>> Props;
-	
-	ClassInfo->SetStringField("className", ClassName);
-	ClassInfo->SetArrayField("classHierarchy", GetClassHierarchy(Class));
-	ClassInfo->SetStringField("path", "Classes/Default/" + ClassName);
+	FDocClass ClassInfo;
+	ClassInfo.ClassName = Model.Intern(ClassName);
+	ClassInfo.HierarchyIndex = GetHierarchyIndex(Class, Model);
+	ClassInfo.Path = Model.Intern("Classes/Default/" + ClassName);
 	if (Class->HasMetaData("ClassFilter"))
 	{
-		ClassInfo->SetStringField("path", FString::Printf(TEXT("Classes/%s/%s"), *Class->GetMetaData("ClassFilter"), *ClassName));
+		ClassInfo.Path = Model.Intern(FString::Printf(TEXT("Classes/%s/%s"), *Class->GetMetaData("ClassFilter"), *ClassName));
 	}
+	// The index the class will get once its members are in
+	const int32 ClassIndex = Model.Classes.Num();
 	TArray<FName> FunctionList;
 	Class->GenerateFunctionList(FunctionList);
+	ClassInfo.Properties.First = Model.Properties.Num();
 	for (TFieldIterator<FProperty> It(Class); It; ++It)
 	{
 		const FProperty* ClassProperty = *It;
@@ -217,31 +290,34 @@ TSharedRef<FJsonObject> FTaskProcessor::SerializeClassInfo(UClass* Class)
 		{
 			continue;
 		}
-		FString Type = ClassProperty->GetCPPType();
-		FString Name = ClassProperty->GetName();
-		TSharedPtr<FJsonObject> JClassProp = MakeShared<FJsonObject>();
-		JClassProp->SetStringField("name", Name);
-		JClassProp->SetStringField("type", Type);
-		JClassProp->SetArrayField("flags", GetPropertyFlags(ClassProperty));
-		JClassProp->SetStringField("description", ClassProperty->GetToolTipText().ToString());
-		Props.Add(MakeShared<FJsonValueObject>(FJsonValueObject(JClassProp)));
+		const FString Type = ClassProperty->GetCPPType();
+		Model.AddTypeUsages(Type, FDocTypeUsage{ 0, EDocTypeRole::Property, ClassIndex, Model.Properties.Num() - ClassInfo.Properties.First });
+		FDocProperty& Prop = Model.Properties.AddDefaulted_GetRef();
+		Prop.Name = Model.Intern(ClassProperty->GetName());
+		Prop.Type = Model.Intern(Type);
+		Prop.Flags = GetPropertyFlags(ClassProperty, Model);
+		Prop.Description = Model.InternText(Texts.GetToolTip(ClassProperty));
 	}
+	ClassInfo.Properties.Num = Model.Properties.Num() - ClassInfo.Properties.First;
+	ClassInfo.Functions.First = Model.Functions.Num();
 	for (auto& Func : FunctionList)
 	{
 		if (const auto Function = Class->FindFunctionByName(Func))
 		{
-			const TSharedPtr<FJsonObject> JFunc = MakeShared<FJsonObject>();
-			TArray<TSharedPtr<FJsonValue>> Params;
-			JFunc->SetStringField("name", Function->GetName());
-			JFunc->SetStringField("description", Function->GetToolTipText().ToString());
-			JFunc->SetArrayField("flags", GetFunctionFlags(Function));
-			JFunc->SetStringField("returnType", "void");
+			FDocComment const& FuncDoc = DocGen->GetDocComment(Function);
+			const int32 FunctionIndex = Model.Functions.Num() - ClassInfo.Functions.First;
+			FDocFunction DocFunc;
+			DocFunc.Name = Model.Intern(Function->GetName());
+			DocFunc.Description = Model.InternText(FuncDoc.Summary, FDocTextSource{ FuncDoc.Source, EDocTextPart::Summary });
+			DocFunc.ReturnDescription = Model.InternText(FuncDoc.Return, FDocTextSource{ FuncDoc.Source, EDocTextPart::Return });
+			DocFunc.Flags = GetFunctionFlags(Function, Model);
+			DocFunc.ReturnType = Model.Intern(TEXT("void"));
+			DocFunc.Parameters.First = Model.Parameters.Num();
 			for (TFieldIterator<FProperty> It(Function); It && It->HasAnyPropertyFlags(CPF_Parm); ++It)
 			{
 				const FProperty* FunctionProperty = *It;
 				FString Type = FunctionProperty->GetCPPType();
 				FString Name = FunctionProperty->GetName();
-				TSharedPtr<FJsonObject> JFuncParam = MakeShared<FJsonObject>();
 				if (FunctionProperty->HasAnyPropertyFlags(CPF_ConstParm))
 				{
 					if (FunctionProperty->HasAnyPropertyFlags(CPF_ReferenceParm | CPF_OutParm))
@@ -252,36 +328,119 @@ TSharedRef<FJsonObject> FTaskProcessor::SerializeClassInfo(UClass* Class)
 				}
 				if (FunctionProperty->HasAnyPropertyFlags(CPF_ReturnParm) || Name == "ReturnValue")
 				{
-					JFunc->SetStringField("returnType", Type);
+					Model.AddTypeUsages(Type, FDocTypeUsage{ 0, EDocTypeRole::Return, ClassIndex, FunctionIndex });
+					DocFunc.ReturnType = Model.Intern(Type);
 					continue;
 				}
-				JFuncParam->SetStringField("name", Name);
-				JFuncParam->SetStringField("type", Type);
-				JFuncParam->SetStringField("description", FunctionProperty->GetToolTipText().ToString());
-				JFuncParam->SetArrayField("flags", GetPropertyFlags(FunctionProperty));
-				Params.Add(MakeShared<FJsonValueObject>(FJsonValueObject(JFuncParam)));
+				Model.AddTypeUsages(Type, FDocTypeUsage{ 0, EDocTypeRole::Parameter, ClassIndex, FunctionIndex, Model.Parameters.Num() - DocFunc.Parameters.First });
+				FDocParameter& Param = Model.Parameters.AddDefaulted_GetRef();
+				Param.Name = Model.Intern(Name);
+				Param.Type = Model.Intern(Type);
+				FString const* ParamDoc = FuncDoc.Params.Find(Name);
+				Param.Description = ParamDoc
+					? Model.InternText(*ParamDoc, FDocTextSource{ FuncDoc.Source, EDocTextPart::Param, 0, Name })
+					: Model.InternText(Texts.GetToolTip(FunctionProperty));
+				Param.Flags = GetPropertyFlags(FunctionProperty, Model);
 			}
-			JFunc->SetArrayField("parameters", Params);
-			Functions.Add(MakeShared<FJsonValueObject>(FJsonValueObject(JFunc)));
+			DocFunc.Parameters.Num = Model.Parameters.Num() - DocFunc.Parameters.First;
+			Model.Functions.Add(DocFunc);
 		}
 	}
-	ClassInfo->SetArrayField("properties", Props);
-	ClassInfo->SetArrayField("functions", Functions);
-	return MakeShared<FJsonObject>(*ClassInfo);
+	ClassInfo.Functions.Num = Model.Functions.Num() - ClassInfo.Functions.First;
+	const int32 Index = Model.Classes.Add(MoveTemp(ClassInfo));
+	Model.Hierarchy[Model.Classes[Index].HierarchyIndex].DocIndex = Index;
+	return Index;
+}
+
+int32 FTaskProcessor::SerializeStructInfo(UScriptStruct* Struct, FDocModel& Model)
+{
+	FFieldTextCache& Texts = DocGen->GetFieldTexts();
+	const FString StructName = Struct->GetPrefixCPP() + Struct->GetName();
+
+	FDocStruct StructInfo;
+	StructInfo.StructName = Model.Intern(StructName);
+	StructInfo.Path = Model.Intern("Structs/" + StructName);
+	if (const UScriptStruct* SuperStruct = Cast<UScriptStruct>(Struct->GetSuperStruct()))
+	{
+		StructInfo.SuperStruct = Model.Intern(SuperStruct->GetPrefixCPP() + SuperStruct->GetName());
+	}
+	StructInfo.Description = Model.InternText(Texts.GetToolTip(Struct));
+	StructInfo.Properties.First = Model.Properties.Num();
+	for (TFieldIterator<FProperty> It(Struct, EFieldIteratorFlags::ExcludeSuper); It; ++It)
+	{
+		const FProperty* StructProperty = *It;
+		const FString Type = StructProperty->GetCPPType();
+		Model.AddTypeUsages(Type, FDocTypeUsage{ 0, EDocTypeRole::StructMember, Model.Structs.Num(), Model.Properties.Num() - StructInfo.Properties.First });
+		FDocProperty& Prop = Model.Properties.AddDefaulted_GetRef();
+		// User defined struct members are stored under generated names
+		Prop.Name = Model.Intern(Struct->GetAuthoredNameForField(StructProperty));
+		Prop.Type = Model.Intern(Type);
+		Prop.Flags = GetPropertyFlags(StructProperty, Model);
+		Prop.Description = Model.InternText(Texts.GetToolTip(StructProperty));
+	}
+	StructInfo.Properties.Num = Model.Properties.Num() - StructInfo.Properties.First;
+	return Model.Structs.Add(StructInfo);
+}
+
+int32 FTaskProcessor::SerializeEnumInfo(UEnum* Enum, FDocModel& Model)
+{
+	FDocEnum EnumInfo;
+	EnumInfo.EnumName = Model.Intern(Enum->GetName());
+	EnumInfo.Path = Model.Intern("Enums/" + Enum->GetName());
+	EnumInfo.Description = Model.InternText(DocGen->GetFieldTexts().GetToolTip(Enum));
+	EnumInfo.Values.First = Model.EnumValues.Num();
+	// The generated _MAX entry is not a real value
+	const int32 NumValues = Enum->ContainsExistingMax() ? Enum->NumEnums() - 1 : Enum->NumEnums();
+	for (int32 Index = 0; Index < NumValues; ++Index)
+	{
+		if (Enum->HasMetaData(TEXT("Hidden"), Index))
+		{
+			continue;
+		}
+		FDocEnumValue& Value = Model.EnumValues.AddDefaulted_GetRef();
+		Value.Name = Model.Intern(Enum->GetNameStringByIndex(Index));
+		Value.DisplayName = Model.InternText(Enum->GetDisplayNameTextByIndex(Index));
+		Value.Description = Model.InternText(Enum->GetToolTipTextByIndex(Index));
+		Value.Value = Enum->GetValueByIndex(Index);
+	}
+	EnumInfo.Values.Num = Model.EnumValues.Num() - EnumInfo.Values.First;
+	return Model.Enums.Add(EnumInfo);
 }
 
 void FTaskProcessor::ProcessTask(TSharedPtr< FGenTask > InTask)
+{
+	Current = MakeUnique< FGenCurrentTask >();
+	Current->Task = InTask;
+
+	GenerateCurrentTask();
+
+	// Whichever way the task ended, on this thread and once whatever it ran detached has returned
+	Current.Reset();
+}
+
+void FTaskProcessor::GenerateCurrentTask()
 {
 	/********** Lambdas for the game thread to execute **********/
 	
 	
 	
-	auto GameThread_InitDocGen = [this](FString const& DocTitle, FString const& IntermediateDir) -> bool
+	auto GameThread_InitDocGen = [this](FString const& IntermediateDir) -> bool
 	{
 		Current->Task->Notification->SetExpireDuration(2.0f);
 		Current->Task->Notification->SetText(LOCTEXT("DocGenInProgress", "Generation in progress..."));
 
-		return Current->DocGen->GT_Init(DocTitle, IntermediateDir, Current->Task->Settings.BlueprintContextClass);
+		if(!Current->DocGen->GT_Init(Current->Task->Settings, IntermediateDir))
+		{
+			return false;
+		}
+
+		if(Current->Task->Settings.bRenderNodeImagesOnDemand && Current->Task->Settings.NodeImageFormat == ENodeImageFormat::Raster)
+		{
+			// Falls back to drawing everything now if the server can't be started
+			auto& Module = FModuleManager::GetModuleChecked< FCTRLDocumentableModule >("CTRLDocumentable");
+			Current->DocGen->SetNodeImageServer(Module.GT_GetNodeImageServer(Current->Task->Settings));
+		}
+		return true;
 	};
 
 	TFunction<void()> GameThread_EnqueueEnumerators = [this]()
@@ -310,12 +469,28 @@ void FTaskProcessor::ProcessTask(TSharedPtr< FGenTask > InTask)
 				continue;
 			}
 			
+			// Structs and enums only need their reflection data, there are no nodes to draw for them
+			if (auto Struct = Cast<UScriptStruct>(Obj))
+			{
+				SerializeStructInfo(Struct, Current->Document);
+				Current->Processed.Add(Obj);
+				continue;
+			}
+			if (auto Enum = Cast<UEnum>(Obj))
+			{
+				SerializeEnumInfo(Enum, Current->Document);
+				Current->Processed.Add(Obj);
+				continue;
+			}
+
 			if (Obj->IsA(UBlueprint::StaticClass()))
 			{
 				UBlueprint* BP = Cast<UBlueprint>(Obj);
 				UClass* Class = BP->GeneratedClass.Get();
-				if (Class && ProcessClass(Class))
-					Classes.Add(MakeShared<FJsonValueObject>(FJsonValueObject(SerializeClassInfo(Class))));
+				if (Class)
+				{
+					AddClass(Class);
+				}
 			}
 
 
@@ -385,17 +560,21 @@ void FTaskProcessor::ProcessTask(TSharedPtr< FGenTask > InTask)
 	/*****************************/
 
 
-	Current = MakeUnique< FGenCurrentTask >();
-	Current->Task = InTask;
+	// The generator keeps its graphs, render targets and parsed doc comments warm between tasks
+	if(!DocGen.IsValid())
+	{
+		DocGen = MakeUnique< FDocumentationGenerator >();
+	}
+	Current->DocGen = DocGen.Get();
+	DocGen->ResetTextCaches();
+
+	GatherNativeClasses(Current->Task->Settings.NativeModules);
 
 	FString IntermediateDir = FPaths::ProjectIntermediateDir() / TEXT("CTRLDocumentable") / Current->Task->Settings.DocumentationTitle;
 
 	CTRLDocumentable::RunOnGameThread(GameThread_EnqueueEnumerators);	
 
-	// Initialize the doc generator
-	Current->DocGen = MakeUnique< FDocumentationGenerator >();
-
-	if(!CTRLDocumentable::RunOnGameThreadRetVal(GameThread_InitDocGen, Current->Task->Settings.DocumentationTitle, IntermediateDir))
+	if(!CTRLDocumentable::RunOnGameThreadRetVal(GameThread_InitDocGen, IntermediateDir))
 	{
 		UE_LOG(LogCTRLDocumentable, Error, TEXT("Failed to initialize generator!"));
 		return;
@@ -407,6 +586,9 @@ void FTaskProcessor::ProcessTask(TSharedPtr< FGenTask > InTask)
 		IFileManager::Get().DeleteDirectory(*IntermediateDir, false, true);
 	}
 
+	// Publish the text as soon as it's ready and draw the images in a second pass
+	const bool bTextFirst = Current->Task->Settings.bPublishTextFirst;
+
 	int SuccessfulNodeCount = 0;
 	while(Current->Enumerators.Dequeue(Current->CurrentEnumerator))
 	{
@@ -422,58 +604,61 @@ void FTaskProcessor::ProcessTask(TSharedPtr< FGenTask > InTask)
 				{
 				// NodeInst should hopefully not reference anything except stuff we control (ie graph object), and it's rooted so should be safe to deal with here
 
-				// Generate image
-				if(!Current->DocGen->GenerateNodeImage(NodeInst, NodeState))
+				if(bTextFirst)
 				{
-					UE_LOG(LogCTRLDocumentable, Warning, TEXT("Failed to generate node image!"))
-					continue;
+					// Only decide where the image will go, it's drawn once the text is out
+					Current->DocGen->PlanNodeImage(NodeInst, NodeState);
+					NodeState.bImagePending = true;
+				}
+				else
+				{
+					// Generate image, waiting for a readback slot first so only a bounded number of nodes are in flight
+					Current->DocGen->WaitForNodeImageSlot();
+					if(!Current->DocGen->GenerateNodeImage(NodeInst, NodeState))
+					{
+						UE_LOG(LogCTRLDocumentable, Warning, TEXT("Failed to generate node image!"))
+						continue;
+					}
 				}
 
-				FJsonObject NodeMeta;
+				int32 NodeIndex = INDEX_NONE;
 
 				// Generate doc
-				if(!Current->DocGen->GenerateNodeDocs(NodeInst, NodeState, NodeMeta))
+				if(!Current->DocGen->GenerateNodeDocs(NodeInst, NodeState, Current->Document, NodeIndex))
 				{
 					UE_LOG(LogCTRLDocumentable, Warning, TEXT("Failed to generate node doc xml!"))
 					continue;
 				}
 				
 
-				for (int i = 0; i < Classes.Num(); i++)
+				TArray< int32 > ClassIndices;
+				Current->ClassIndexById.MultiFind(Current->Document.GetString(Current->Document.Nodes[NodeIndex].ClassId).ToLower(), ClassIndices);
+				for (int32 ClassIndex : ClassIndices)
 				{
-					FString ClassName = Classes[i]->AsObject()->GetStringField(TEXT("className"));
-
-					if (ClassName.Contains("ASKEL_"))
-					{
-						ClassName = ClassName.Replace(TEXT("ASKEL_"), TEXT(""));
-						ClassName = ClassName.Replace(TEXT("_C"), TEXT(""));
-					}
-
-					if (ClassName.Contains("USKEL_"))
-					{
-						ClassName = ClassName.Replace(TEXT("USKEL_"), TEXT(""));
-						ClassName = ClassName.Replace(TEXT("_C"), TEXT(""));
-					}
-					
-					FString ClassId = NodeMeta.GetStringField(TEXT("classId"));
-					if ( ClassName.Equals(ClassId, ESearchCase::IgnoreCase))
-					{
-						TArray<TSharedPtr<FJsonValue>> Nodes;
-						if (Classes[i]->AsObject()->HasField(TEXT("nodes")))
-						{
-							Nodes = Classes[i]->AsObject()->GetArrayField(TEXT("nodes"));
-						}
-						Nodes.Add(MakeShared<FJsonValueObject>(MakeShared<FJsonObject>(NodeMeta)));
-						Classes[i]->AsObject()->SetArrayField("nodes", Nodes);
-					}
+					Current->Document.Classes[ClassIndex].Nodes.Add(NodeIndex);
 				}
 				
+				if(bTextFirst)
+				{
+					Current->PendingImages.Add(FPendingNodeImage{ NodeInst, NodeState, NodeIndex });
+				}
 
 				++SuccessfulNodeCount;
 				}
+
+			// Draw this object's nodes together while their batch is still small and related.
+			// Sprite sheets are sealed once all images are in, sealing drains the whole pipeline.
+			Current->DocGen->SubmitNodeImageBatch();
 			}
 	}
 
+	if(!bTextFirst)
+	{
+		// Let the remaining readbacks land and their images hit the disk before publishing
+		Current->DocGen->FinalizeNodeImages(Current->Document, true);
+		Current->DocGen->OptimizeNodeImages([this] { return (bool)bTerminationRequest; });
+	}
+
 	if(SuccessfulNodeCount == 0)
 	{
 		UE_LOG(LogCTRLDocumentable, Error, TEXT("No nodes were found to document!"));
@@ -488,81 +673,219 @@ void FTaskProcessor::ProcessTask(TSharedPtr< FGenTask > InTask)
 		return;
 	}
 	
-	FString JsonString;
-	FJsonObject* Nodes = new FJsonObject;
-	Nodes->SetArrayField("nodes", Classes);
-	FJsonSerializer::Serialize(MakeShared<FJsonObject>(*Nodes), TJsonWriterFactory<>::Create(&JsonString, 0));
+	WriteNodeData();
+
+	if(Current->Task->Settings.AdditionalCultures.Num() > 0)
+	{
+		// Same docs, only their texts resolved again per culture. Fetched by the viewer when a culture is picked.
+		const FString TableDir = FPaths::Combine(IPluginManager::Get().FindPlugin("CTRLDocumentable")->GetBaseDir() + "/web/public") / TEXT("locales");
+		CTRLDocumentable::WriteCultureStringTables(Current->Document, Current->Task->Settings.AdditionalCultures, TableDir);
+	}
+
+	if(bTextFirst)
+	{
+		CTRLDocumentable::RunDetached([this]
+		{
+			LaunchViewer();
+		});
+
+		CTRLDocumentable::RunOnGameThread([this]
+		{
+			Current->Task->Notification->SetText(LOCTEXT("DocTextPublished", "Docs published, rendering node images..."));
+		});
+
+		if(!RenderPendingNodeImages())
+		{
+			return;
+		}
+	}
+
+	if(!Current->SearchIndex.IsValid())
+	{
+		Current->SearchIndex = MakeShared< FDocSearchIndex >();
+		Current->SearchIndex->Build(Current->Document);
+	}
+
+	TArray64< uint8 > Cache = CTRLDocumentable::BuildDocumentCache(Current->Document, *Current->SearchIndex,
+		CTRLDocumentable::GetDocumentCacheFingerprint(Current->Task->Settings));
+
+	// Editor tooling can query the docs from now on, served from the same bytes; the task has no more use for the model
+	Current->Document.Reset();
+	Current->SearchIndex.Reset();
+	TUniquePtr< FDocCacheReader > Reader = MakeUnique< FDocCacheReader >();
+	FDocCacheReader const& CacheReader = *Reader;
+	TSharedRef< FGeneratedDocumentIndex > Index = MakeShared< FGeneratedDocumentIndex >();
+	if(Reader->Open(MoveTemp(Cache)) && Index->Open(MoveTemp(Reader)))
+	{
+		// Replaces the index of the last session first, which still maps the file the cache is saved over
+		CTRLDocumentable::RunOnGameThread([Index]
+		{
+			FModuleManager::GetModuleChecked< FCTRLDocumentableModule >("CTRLDocumentable").GT_SetDocumentIndex(Index);
+		});
+
+		// Kept for the next editor session, which maps it back instead of waiting for a generation
+		CTRLDocumentable::SaveDocumentCache(CacheReader.GetBytes(), CTRLDocumentable::GetDocumentCachePath());
+	}
+
+	CTRLDocumentable::RunDetached([this, bTextFirst]
+	{
+		if(!bTextFirst && !LaunchViewer())
+		{
+			return;
+		}
+		CTRLDocumentable::RunOnGameThread([this]
+		{
+			Current->Task->Notification->SetText(LOCTEXT("DocConversionSuccessful", "Generation complete!"));
+			Current->Task->Notification->SetCompletionState(SNotificationItem::CS_Success);
+			Current->Task->Notification->ExpireAndFadeout();
+		});
+	});
+
+}
+
+void FTaskProcessor::WriteNodeData()
+{
+	Current->Document.LinkHierarchy();
+	Current->Document.LinkInheritedMembers();
+	const FString JsonString = Current->Document.ToNodesJson();
+
+	// Written next to the target and moved over it, so a viewer picking up the change never reads half a file
+	// Served rather than bundled: the viewer fetches it once navigation/index.json has put up the sidebar
+	const FString DataPath = FPaths::Combine(IPluginManager::Get().FindPlugin("CTRLDocumentable")->GetBaseDir() +"/web/public") + "/nodes.json";
+	const FString TempPath = DataPath + TEXT(".tmp");
+	if(!FFileHelper::SaveStringToFile(JsonString, *TempPath, FFileHelper::EEncodingOptions::ForceUTF8)
+		|| !IFileManager::Get().Move(*DataPath, *TempPath, true, true))
+	{
+		UE_LOG(LogCTRLDocumentable, Error, TEXT("Failed to write %s"), *DataPath);
+	}
 
-	FFileHelper::SaveStringToFile(JsonString, *(FPaths::Combine(IPluginManager::Get().FindPlugin("CTRLDocumentable")->GetBaseDir() +"/web/src/data") + "/nodes.json"), FFileHelper::EEncodingOptions::ForceUTF8);
-	CTRLDocumentable::RunDetached([this]
+	// Indices only change with the text, which is complete the first time through
+	if(!Current->SearchIndex.IsValid())
 	{
-		#if PLATFORM_WINDOWS
-		FString Cmd = FWindowsPlatformMisc::GetEnvironmentVariable(*FString("COMSPEC"));
-		#endif
+		const FString PublicDir = FPaths::Combine(IPluginManager::Get().FindPlugin("CTRLDocumentable")->GetBaseDir() + "/web/public");
 
-		#if PLATFORM_LINUX
-		FString Cmd = "/bin/sh";
-		#endif
+		// Fetched by the viewer one shard at a time, so it goes with the served files rather than the bundled data
+		Current->SearchIndex = MakeShared< FDocSearchIndex >();
+		Current->SearchIndex->Build(Current->Document);
+		Current->SearchIndex->Write(Current->Document, PublicDir / TEXT("search"));
 
-		// TODO: check if NPM is installed on user's computer before attempting to start the server
+		CTRLDocumentable::WriteTypeIndex(Current->Document, PublicDir / TEXT("types"));
+		CTRLDocumentable::WriteNavigationTree(Current->Document, PublicDir / TEXT("navigation"));
+	}
+}
+
+bool FTaskProcessor::LaunchViewer()
+{
+	#if PLATFORM_WINDOWS
+	FString Cmd = FWindowsPlatformMisc::GetEnvironmentVariable(*FString("COMSPEC"));
+	#endif
 
-		if (Current->Task->Settings.StartNodeServer == true)
+	#if PLATFORM_LINUX
+	FString Cmd = "/bin/sh";
+	#endif
+
+	// TODO: check if NPM is installed on user's computer before attempting to start the server
+
+	if (Current->Task->Settings.StartNodeServer == true)
+	{
+		FString WorkingDir = FPaths::Combine(IPluginManager::Get().FindPlugin("CTRLDocumentable")->GetBaseDir() + "/web");
+		if (!FPaths::DirectoryExists(FPaths::Combine(WorkingDir, "node_modules")))
 		{
-			FString WorkingDir = FPaths::Combine(IPluginManager::Get().FindPlugin("CTRLDocumentable")->GetBaseDir() + "/web");
-			if (!FPaths::DirectoryExists(FPaths::Combine(WorkingDir, "node_modules")))
+			CTRLDocumentable::RunOnGameThread([this]
 			{
-				CTRLDocumentable::RunOnGameThread([this]
-				{
-					Current->Task->Notification->SetText(FText::FromString("Installing node modules"));
-					Current->Task->Notification->SetExpireDuration(3600);
-				});
-				void* PipeWrite = nullptr;
-				FProcHandle Proc = FPlatformProcess::CreateProc(
-					*Cmd,
-					TEXT("/c \"npm i\""),
-					true,
-					true,
-					true,
-					nullptr,
-					0,
-					*WorkingDir,
-					PipeWrite
-				);
-				for(bool bProcessFinished = false; !bProcessFinished; )
-				{
-					bProcessFinished = !FPlatformProcess::IsProcRunning(Proc);
-					
-					if(bTerminationRequest)
-					{
-						FPlatformProcess::TerminateProc(Proc, true);
-						bProcessFinished = true;
-						return;
-					}
-				}
-			}
-			
+				Current->Task->Notification->SetText(FText::FromString("Installing node modules"));
+				Current->Task->Notification->SetExpireDuration(3600);
+			});
 			void* PipeWrite = nullptr;
 			FProcHandle Proc = FPlatformProcess::CreateProc(
 				*Cmd,
-				TEXT("/c \"set port=3012 && npm run dev\""),
+				TEXT("/c \"npm i\""),
+				true,
+				true,
 				true,
-				false,
-				false,
 				nullptr,
 				0,
 				*WorkingDir,
 				PipeWrite
 			);
+			for(bool bProcessFinished = false; !bProcessFinished; )
+			{
+				bProcessFinished = !FPlatformProcess::IsProcRunning(Proc);
+				
+				if(bTerminationRequest)
+				{
+					FPlatformProcess::TerminateProc(Proc, true);
+					bProcessFinished = true;
+					return false;
+				}
+			}
 		}
-		CTRLDocumentable::RunOnGameThread([this]
+		
+		void* PipeWrite = nullptr;
+		FProcHandle Proc = FPlatformProcess::CreateProc(
+			*Cmd,
+			TEXT("/c \"set port=3012 && npm run dev\""),
+			true,
+			false,
+			false,
+			nullptr,
+			0,
+			*WorkingDir,
+			PipeWrite
+		);
+	}
+	return true;
+}
+
+bool FTaskProcessor::RenderPendingNodeImages()
+{
+	// How often the partially imaged docs are republished
+	const double RepublishInterval = 10.0;
+	double LastPublishTime = FPlatformTime::Seconds();
+
+	TWeakObjectPtr< UObject > LastSourceObject;
+	for(auto& Pending : Current->PendingImages)
+	{
+		if(bTerminationRequest)
 		{
-			Current->Task->Notification->SetText(LOCTEXT("DocConversionSuccessful", "Generation complete!"));
-			Current->Task->Notification->SetCompletionState(SNotificationItem::CS_Success);
-			Current->Task->Notification->ExpireAndFadeout();
-		});
-		Current.Reset();
-	});
+			return false;
+		}
+
+		// Keep each object's nodes together in a batch, as the single pass does
+		if(Pending.State.SourceObject != LastSourceObject)
+		{
+			Current->DocGen->SubmitNodeImageBatch();
+			LastSourceObject = Pending.State.SourceObject;
+
+			if(FPlatformTime::Seconds() - LastPublishTime > RepublishInterval)
+			{
+				if(Current->DocGen->FinalizeNodeImages(Current->Document, false))
+				{
+					WriteNodeData();
+				}
+				LastPublishTime = FPlatformTime::Seconds();
+			}
+		}
+
+		Current->DocGen->WaitForNodeImageSlot();
+		if(!Current->DocGen->GenerateNodeImage(Pending.Node, Pending.State))
+		{
+			UE_LOG(LogCTRLDocumentable, Warning, TEXT("Failed to generate node image!"))
+		}
+	}
 
+	Current->DocGen->FinalizeNodeImages(Current->Document, true);
+	Current->DocGen->OptimizeNodeImages([this] { return (bool)bTerminationRequest; });
+
+	// Whatever failed to draw isn't coming anymore
+	for(auto const& Pending : Current->PendingImages)
+	{
+		Current->Document.Nodes[Pending.NodeIndex].bImgPending = false;
+	}
+	Current->PendingImages.Empty();
+
+	WriteNodeData();
+	return true;
 }
 
 FTaskProcessor::EIntermediateProcessingResult FTaskProcessor::ProcessIntermediateDocs(FString const& IntermediateDir, FString const& OutputDir, FString const& DocTitle, bool bCleanOutput)
@@ -663,9 +986,9 @@ FTaskProcessor::EIntermediateProcessingResult FTaskProcessor::ProcessIntermediat
 	}
 }
 
-TArray<TSharedPtr<FJsonValue>> FTaskProcessor::GetPropertyFlags(const FProperty* Property)
+FDocRange FTaskProcessor::GetPropertyFlags(const FProperty* Property, FDocModel& Model)
 {
-	TArray<TSharedPtr<FJsonValue>> Output;
+	TArray<FDocStringId, TInlineAllocator<16>> Output;
 
 	if (const auto Map = Property->GetMetaDataMap())
 	{
@@ -673,223 +996,223 @@ TArray<TSharedPtr<FJsonValue>> FTaskProcessor::GetPropertyFlags(const FProperty*
 		{
 			if (KeyValue.Value.IsEmpty())
 			{
-				Output.Add(MakeShared<FJsonValueString>(FJsonValueString(KeyValue.Key.ToString())));
+				Output.Add(Model.Intern(KeyValue.Key.ToString()));
 			}
 			else
 			{
 				FString Meta = FString::Printf(TEXT("%ls = %ls"), *KeyValue.Key.ToString(), *KeyValue.Value);
-				Output.Add(MakeShared<FJsonValueString>(FJsonValueString(Meta)));
+				Output.Add(Model.Intern(Meta));
 			}
 		}
 	}
 
 	if (Property->HasAnyPropertyFlags(EPropertyFlags::CPF_NativeAccessSpecifierPublic))
 	{
-		Output.Add(MakeShared<FJsonValueString>(FJsonValueString("Public")));
+		Output.Add(Model.Intern("Public"));
 	}
 	if (Property->HasAnyPropertyFlags(EPropertyFlags::CPF_NativeAccessSpecifierProtected))
 	{
-		Output.Add(MakeShared<FJsonValueString>(FJsonValueString("Protected")));
+		Output.Add(Model.Intern("Protected"));
 	}
 	if (Property->HasAnyPropertyFlags(EPropertyFlags::CPF_NativeAccessSpecifierPrivate))
 	{
-		Output.Add(MakeShared<FJsonValueString>(FJsonValueString("Private")));
+		Output.Add(Model.Intern("Private"));
 	}
 	if (Property->HasAnyPropertyFlags(EPropertyFlags::CPF_EditorOnly))
 	{
-		Output.Add(MakeShared<FJsonValueString>(FJsonValueString("EditorOnly")));
+		Output.Add(Model.Intern("EditorOnly"));
 	}
 	if (Property->HasAnyPropertyFlags(EPropertyFlags::CPF_BlueprintReadOnly))
 	{
-		Output.Add(MakeShared<FJsonValueString>(FJsonValueString("BlueprintReadOnly")));
+		Output.Add(Model.Intern("BlueprintReadOnly"));
 	}
 	if (Property->HasAnyPropertyFlags(EPropertyFlags::CPF_BlueprintAssignable))
 	{
-		Output.Add(MakeShared<FJsonValueString>(FJsonValueString("BlueprintAssignable")));
+		Output.Add(Model.Intern("BlueprintAssignable"));
 	}
 	if (Property->HasAnyPropertyFlags(EPropertyFlags::CPF_BlueprintVisible))
 	{
-		Output.Add(MakeShared<FJsonValueString>(FJsonValueString("BlueprintVisible")));
+		Output.Add(Model.Intern("BlueprintVisible"));
 	}
 	if (Property->HasAnyPropertyFlags(EPropertyFlags::CPF_BlueprintCallable))
 	{
-		Output.Add(MakeShared<FJsonValueString>(FJsonValueString("BlueprintCallable")));
+		Output.Add(Model.Intern("BlueprintCallable"));
 	}
 	if (Property->HasAnyPropertyFlags(EPropertyFlags::CPF_BlueprintAuthorityOnly))
 	{
-		Output.Add(MakeShared<FJsonValueString>(FJsonValueString("BlueprintAuthorityOnly")));
+		Output.Add(Model.Intern("BlueprintAuthorityOnly"));
 	}
 	if (Property->HasAnyPropertyFlags(EPropertyFlags::CPF_Deprecated))
 	{
-		Output.Add(MakeShared<FJsonValueString>(FJsonValueString("Deprecated")));
+		Output.Add(Model.Intern("Deprecated"));
 	}
 	if (Property->HasAnyPropertyFlags(EPropertyFlags::CPF_ExposeOnSpawn))
 	{
-		Output.Add(MakeShared<FJsonValueString>(FJsonValueString("ExposeOnSpawn")));
+		Output.Add(Model.Intern("ExposeOnSpawn"));
 	}
 	if (Property->HasAnyPropertyFlags(EPropertyFlags::CPF_Edit))
 	{
-		Output.Add(MakeShared<FJsonValueString>(FJsonValueString("Edit")));
+		Output.Add(Model.Intern("Edit"));
 	}
 	if (Property->HasAnyPropertyFlags(EPropertyFlags::CPF_EditConst))
 	{
-		Output.Add(MakeShared<FJsonValueString>(FJsonValueString("EditConst")));
+		Output.Add(Model.Intern("EditConst"));
 	}
 	
 	if (Property->HasAnyPropertyFlags(EPropertyFlags::CPF_Config))
 	{
-		Output.Add(MakeShared<FJsonValueString>(FJsonValueString("Config")));
+		Output.Add(Model.Intern("Config"));
 	}
 
 	if (Property->HasAnyPropertyFlags(EPropertyFlags::CPF_SaveGame))
 	{
-		Output.Add(MakeShared<FJsonValueString>(FJsonValueString("SaveGame")));
+		Output.Add(Model.Intern("SaveGame"));
 	}
 
 	if (Property->HasAnyPropertyFlags(EPropertyFlags::CPF_GlobalConfig))
 	{
-		Output.Add(MakeShared<FJsonValueString>(FJsonValueString("GlobalConfig")));
+		Output.Add(Model.Intern("GlobalConfig"));
 	}
 
 	if (Property->HasAnyPropertyFlags(EPropertyFlags::CPF_Config))
 	{
-		Output.Add(MakeShared<FJsonValueString>(FJsonValueString("Config")));
+		Output.Add(Model.Intern("Config"));
 	}
 
 	if (Property->HasAnyPropertyFlags(EPropertyFlags::CPF_Parm))
 	{
-		Output.Add(MakeShared<FJsonValueString>(FJsonValueString("Parm")));
+		Output.Add(Model.Intern("Parm"));
 	}
 
 	if (Property->HasAnyPropertyFlags(EPropertyFlags::CPF_OutParm))
 	{
-		Output.Add(MakeShared<FJsonValueString>(FJsonValueString("OutParm")));
+		Output.Add(Model.Intern("OutParm"));
 	}
 
 	if (Property->HasAnyPropertyFlags(EPropertyFlags::CPF_ConstParm))
 	{
-		Output.Add(MakeShared<FJsonValueString>(FJsonValueString("ConstParm")));
+		Output.Add(Model.Intern("ConstParm"));
 	}
 
 	if (Property->HasAnyPropertyFlags(EPropertyFlags::CPF_RequiredParm))
 	{
-		Output.Add(MakeShared<FJsonValueString>(FJsonValueString("RequiredParm")));
+		Output.Add(Model.Intern("RequiredParm"));
 	}
 
 	if (Property->HasAnyPropertyFlags(EPropertyFlags::CPF_ReferenceParm))
 	{
-		Output.Add(MakeShared<FJsonValueString>(FJsonValueString("ReferenceParm")));
+		Output.Add(Model.Intern("ReferenceParm"));
 
 	}
 	if (Property->HasAnyPropertyFlags(EPropertyFlags::CPF_ReturnParm))
 	{
-		Output.Add(MakeShared<FJsonValueString>(FJsonValueString("ReturnParm")));
+		Output.Add(Model.Intern("ReturnParm"));
 
 	}
-	return Output;
+	return Model.AddStringList(Output);
 }
 
-TArray<TSharedPtr<FJsonValue>> FTaskProcessor::GetFunctionFlags(const UFunction* Function)
+FDocRange FTaskProcessor::GetFunctionFlags(const UFunction* Function, FDocModel& Model)
 {
-	TArray<TSharedPtr<FJsonValue>> Output;
+	TArray<FDocStringId, TInlineAllocator<16>> Output;
 	if (Function->HasAnyFunctionFlags(EFunctionFlags::FUNC_Final))
 	{
-		Output.Add(MakeShared<FJsonValueString>(FJsonValueString("Final")));
+		Output.Add(Model.Intern("Final"));
 	}
 	if (Function->HasAnyFunctionFlags(EFunctionFlags::FUNC_RequiredAPI))
 	{
-		Output.Add(MakeShared<FJsonValueString>(FJsonValueString("RequiredAPI")));
+		Output.Add(Model.Intern("RequiredAPI"));
 	}
 	if (Function->HasAnyFunctionFlags(EFunctionFlags::FUNC_BlueprintAuthorityOnly))
 	{
-		Output.Add(MakeShared<FJsonValueString>(FJsonValueString("BlueprintAuthorityOnly")));
+		Output.Add(Model.Intern("BlueprintAuthorityOnly"));
 	}
 	if (Function->HasAnyFunctionFlags(EFunctionFlags::FUNC_BlueprintCosmetic))
 	{
-		Output.Add(MakeShared<FJsonValueString>(FJsonValueString("BlueprintCosmetic")));
+		Output.Add(Model.Intern("BlueprintCosmetic"));
 	}
 	if (Function->HasAnyFunctionFlags(EFunctionFlags::FUNC_NetReliable))
 	{
-		Output.Add(MakeShared<FJsonValueString>(FJsonValueString("NetReliable")));
+		Output.Add(Model.Intern("NetReliable"));
 	}
 	if (Function->HasAnyFunctionFlags(EFunctionFlags::FUNC_Exec))
 	{
-		Output.Add(MakeShared<FJsonValueString>(FJsonValueString("Exec")));
+		Output.Add(Model.Intern("Exec"));
 	}
 	if (Function->HasAnyFunctionFlags(EFunctionFlags::FUNC_Native))
 	{
-		Output.Add(MakeShared<FJsonValueString>(FJsonValueString("Native")));
+		Output.Add(Model.Intern("Native"));
 	}
 	if (Function->HasAnyFunctionFlags(EFunctionFlags::FUNC_Event))
 	{
-		Output.Add(MakeShared<FJsonValueString>(FJsonValueString("Event")));
+		Output.Add(Model.Intern("Event"));
 	}
 	if (Function->HasAnyFunctionFlags(EFunctionFlags::FUNC_Static))
 	{
-		Output.Add(MakeShared<FJsonValueString>(FJsonValueString("Static")));
+		Output.Add(Model.Intern("Static"));
 	}
 	if (Function->HasAnyFunctionFlags(EFunctionFlags::FUNC_NetMulticast))
 	{
-		Output.Add(MakeShared<FJsonValueString>(FJsonValueString("NetMulticast")));
+		Output.Add(Model.Intern("NetMulticast"));
 	}
 	if (Function->HasAnyFunctionFlags(EFunctionFlags::FUNC_MulticastDelegate))
 	{
-		Output.Add(MakeShared<FJsonValueString>(FJsonValueString("MulticastDelegate")));
+		Output.Add(Model.Intern("MulticastDelegate"));
 	}
 	if (Function->HasAnyFunctionFlags(EFunctionFlags::FUNC_Public))
 	{
-		Output.Add(MakeShared<FJsonValueString>(FJsonValueString("Public")));
+		Output.Add(Model.Intern("Public"));
 	}
 	if (Function->HasAnyFunctionFlags(EFunctionFlags::FUNC_Private))
 	{
-		Output.Add(MakeShared<FJsonValueString>(FJsonValueString("Private")));
+		Output.Add(Model.Intern("Private"));
 	}
 	if (Function->HasAnyFunctionFlags(EFunctionFlags::FUNC_Protected))
 	{
-		Output.Add(MakeShared<FJsonValueString>(FJsonValueString("Protected")));
+		Output.Add(Model.Intern("Protected"));
 	}
 	if (Function->HasAnyFunctionFlags(EFunctionFlags::FUNC_Delegate))
 	{
-		Output.Add(MakeShared<FJsonValueString>(FJsonValueString("Delegate")));
+		Output.Add(Model.Intern("Delegate"));
 	}
 	if (Function->HasAnyFunctionFlags(EFunctionFlags::FUNC_HasOutParms))
 	{
-		Output.Add(MakeShared<FJsonValueString>(FJsonValueString("HasOutParams")));
+		Output.Add(Model.Intern("HasOutParams"));
 	}
 	if (Function->HasAnyFunctionFlags(EFunctionFlags::FUNC_HasDefaults))
 	{
-		Output.Add(MakeShared<FJsonValueString>(FJsonValueString("HasDefaults")));
+		Output.Add(Model.Intern("HasDefaults"));
 	}
 	if (Function->HasAnyFunctionFlags(EFunctionFlags::FUNC_NetClient))
 	{
-		Output.Add(MakeShared<FJsonValueString>(FJsonValueString("NetClient")));
+		Output.Add(Model.Intern("NetClient"));
 	}
 	if (Function->HasAnyFunctionFlags(EFunctionFlags::FUNC_DLLImport))
 	{
-		Output.Add(MakeShared<FJsonValueString>(FJsonValueString("DLLImport")));
+		Output.Add(Model.Intern("DLLImport"));
 	}
 	if (Function->HasAnyFunctionFlags(EFunctionFlags::FUNC_BlueprintCallable))
 	{
-		Output.Add(MakeShared<FJsonValueString>(FJsonValueString("BlueprintCallable")));
+		Output.Add(Model.Intern("BlueprintCallable"));
 
 	}
 	if (Function->HasAnyFunctionFlags(EFunctionFlags::FUNC_BlueprintEvent))
 	{
-		Output.Add(MakeShared<FJsonValueString>(FJsonValueString("BlueprintEvent")));
+		Output.Add(Model.Intern("BlueprintEvent"));
 	}
 	if (Function->HasAnyFunctionFlags(EFunctionFlags::FUNC_BlueprintPure))
 	{
-		Output.Add(MakeShared<FJsonValueString>(FJsonValueString("BlueprintPure")));
+		Output.Add(Model.Intern("BlueprintPure"));
 	}
 	if (Function->HasAnyFunctionFlags(EFunctionFlags::FUNC_EditorOnly))
 	{
-		Output.Add(MakeShared<FJsonValueString>(FJsonValueString("EditorOnly")));
+		Output.Add(Model.Intern("EditorOnly"));
 	}
 	if (Function->HasAnyFunctionFlags(EFunctionFlags::FUNC_Const))
 	{
-		Output.Add(MakeShared<FJsonValueString>(FJsonValueString("Const")));
+		Output.Add(Model.Intern("Const"));
 	}
-	return Output;
+	return Model.AddStringList(Output);
 }
 
 #undef LOCTEXT_NAMESPACE
@@ -0,0 +1,50 @@
+// This Source Code Form is subject to the terms of the Mozilla Public
+// License, v. 2.0. If a copy of the MPL was not distributed with this
+// file, You can obtain one at http://mozilla.org/MPL/2.0/.
+
+// Copyright (C) 2023-2025 NTY.studio. All Rights Reserved.
+
+#include "Docs/DocComment.h"
+#include "Misc/AutomationTest.h"
+
+#if WITH_DEV_AUTOMATION_TESTS
+
+IMPLEMENT_SIMPLE_AUTOMATION_TEST(FDocCommentParseTest, "CTRLDocumentable.Docs.DocComment.Parse",
+	EAutomationTestFlags::EditorContext | EAutomationTestFlags::EngineFilter)
+
+bool FDocCommentParseTest::RunTest(FString const& Parameters)
+{
+	// Sections run over several lines, tags may be indented and a lone @ is plain text
+	const FDocComment Comment = FDocComment::Parse(
+		TEXT("Moves the actor\n")
+		TEXT("   to a new place.  @ see below\n")
+		TEXT("@\n")
+		TEXT("  @param NewLocation   Where it goes,\n")
+		TEXT("       in world space\n")
+		TEXT("@Param bSweep\n")
+		TEXT("@see Teleport\n")
+		TEXT("@return True if\tit moved\n")
+		TEXT("@note Slow"));
+
+	TestEqual(TEXT("Summary"), Comment.Summary, FString(TEXT("Moves the actor to a new place. @ see below @")));
+	TestEqual(TEXT("Params"), Comment.Params.Num(), 2);
+	TestEqual(TEXT("Param"), Comment.Params.FindRef(TEXT("NewLocation")), FString(TEXT("Where it goes, in world space")));
+	TestTrue(TEXT("Param names are case insensitive"), Comment.Params.Contains(TEXT("newlocation")));
+	TestTrue(TEXT("Param without description"), Comment.Params.Contains(TEXT("bSweep")) && Comment.Params.FindRef(TEXT("bSweep")).IsEmpty());
+	TestEqual(TEXT("Return"), Comment.Return, FString(TEXT("True if it moved")));
+	if(TestEqual(TEXT("Tags"), Comment.Tags.Num(), 2))
+	{
+		TestTrue(TEXT("First tag"), Comment.Tags[0].Key == TEXT("see") && Comment.Tags[0].Value == TEXT("Teleport"));
+		TestTrue(TEXT("Second tag"), Comment.Tags[1].Key == TEXT("note") && Comment.Tags[1].Value == TEXT("Slow"));
+	}
+
+	const FDocComment Returns = FDocComment::Parse(TEXT("@returns\n  Nothing"));
+	TestTrue(TEXT("@returns without summary"), Returns.Summary.IsEmpty() && Returns.Return == TEXT("Nothing"));
+
+	const FDocComment Empty = FDocComment::Parse(TEXT(" \n\t\n"));
+	TestTrue(TEXT("Blank text"), Empty.Summary.IsEmpty() && Empty.Params.Num() == 0 && Empty.Return.IsEmpty() && Empty.Tags.Num() == 0);
+
+	return true;
+}
+
+#endif
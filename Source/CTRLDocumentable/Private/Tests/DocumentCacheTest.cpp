@@ -0,0 +1,202 @@
+// This Source Code Form is subject to the terms of the Mozilla Public
+// License, v. 2.0. If a copy of the MPL was not distributed with this
+// file, You can obtain one at http://mozilla.org/MPL/2.0/.
+
+// Copyright (C) 2023-2025 NTY.studio. All Rights Reserved.
+
+#include "Docs/DocumentCache.h"
+#include "Docs/GeneratedDocumentIndex.h"
+#include "Docs/SearchIndex.h"
+#include "DocumentModel.h"
+#include "GenerationSettings.h"
+#include "HAL/FileManager.h"
+#include "Misc/AutomationTest.h"
+#include "Misc/Paths.h"
+
+#if WITH_DEV_AUTOMATION_TESTS
+
+namespace
+{
+	/** One class below an undocumented root with a property, a function and its call node, a struct both use and an enum. */
+	void MakeCacheModel(FDocModel& Model)
+	{
+		const int32 Root = Model.AddHierarchyEntry(Model.Intern(TEXT("UObject")), INDEX_NONE);
+
+		FDocClass Helper;
+		Helper.ClassName = Model.Intern(TEXT("UHttpRequestHelper"));
+		Helper.Path = Model.Intern(TEXT("Net/UHttpRequestHelper"));
+		Helper.HierarchyIndex = Model.AddHierarchyEntry(Helper.ClassName, Root);
+		Model.Hierarchy[Helper.HierarchyIndex].DocIndex = Model.Classes.Num();
+
+		Helper.Properties = FDocRange{ Model.Properties.Num(), 1 };
+		Model.Properties.Add(FDocProperty{ Model.Intern(TEXT("Defaults")), Model.Intern(TEXT("TArray<FRequestOptions>")) });
+		Model.AddTypeUsages(TEXT("TArray<FRequestOptions>"), FDocTypeUsage{ 0, EDocTypeRole::Property, Model.Classes.Num(), 0 });
+
+		Helper.Functions = FDocRange{ Model.Functions.Num(), 1 };
+		Model.Functions.Add(FDocFunction{ Model.Intern(TEXT("SendRequest")), Model.Intern(TEXT("Sends the request to the server")), 0, 0, FDocRange(), FDocRange{ Model.Parameters.Num(), 1 } });
+		Model.Parameters.Add(FDocParameter{ Model.Intern(TEXT("Options")), Model.Intern(TEXT("const FRequestOptions&")) });
+		Model.AddTypeUsages(TEXT("const FRequestOptions&"), FDocTypeUsage{ 0, EDocTypeRole::Parameter, Model.Classes.Num(), 0, 0 });
+
+		FDocNode Node;
+		Node.DocsName = Model.Intern(TEXT("K2Node_CallFunction_SendRequest"));
+		Node.ShortTitle = Model.Intern(TEXT("Send Request"));
+		Node.FullTitle = Node.ShortTitle;
+		Node.Function = Model.Intern(TEXT("/Script/Net.HttpRequestHelper:SendRequest"));
+		Helper.Nodes.Add(Model.Nodes.Add(Node));
+		Model.Classes.Add(MoveTemp(Helper));
+
+		FDocStruct Options;
+		Options.StructName = Model.Intern(TEXT("FRequestOptions"));
+		Options.Properties = FDocRange{ Model.Properties.Num(), 1 };
+		Model.Properties.Add(FDocProperty{ Model.Intern(TEXT("Timeout")), Model.Intern(TEXT("float")) });
+		Model.Structs.Add(Options);
+
+		FDocEnum Verb;
+		Verb.EnumName = Model.Intern(TEXT("EHttpVerb"));
+		Verb.Values = FDocRange{ Model.EnumValues.Num(), 2 };
+		Model.EnumValues.Add(FDocEnumValue{ Model.Intern(TEXT("Get")), Model.Intern(TEXT("GET")), 0, 0 });
+		Model.EnumValues.Add(FDocEnumValue{ Model.Intern(TEXT("Post")), Model.Intern(TEXT("POST")), 0, 1 });
+		Model.Enums.Add(Verb);
+
+		Model.LinkHierarchy();
+		Model.LinkInheritedMembers();
+	}
+
+	TUniquePtr< FDocCacheReader > OpenBytes(TArray64< uint8 > Bytes)
+	{
+		TUniquePtr< FDocCacheReader > Reader = MakeUnique< FDocCacheReader >();
+		return Reader->Open(MoveTemp(Bytes)) ? MoveTemp(Reader) : nullptr;
+	}
+}
+
+
+IMPLEMENT_SIMPLE_AUTOMATION_TEST(FDocumentCacheRoundTripTest, "CTRLDocumentable.Docs.DocumentCache.RoundTrip",
+	EAutomationTestFlags::EditorContext | EAutomationTestFlags::EngineFilter)
+
+bool FDocumentCacheRoundTripTest::RunTest(FString const& Parameters)
+{
+	FDocModel Model;
+	MakeCacheModel(Model);
+	FDocSearchIndex SearchIndex;
+	SearchIndex.Build(Model);
+
+	FGenerationSettings Settings;
+	const uint32 Fingerprint = CTRLDocumentable::GetDocumentCacheFingerprint(Settings);
+	const FString Path = FPaths::AutomationTransientDir() / TEXT("DocumentCacheTest.bin");
+	if(!TestTrue(TEXT("Saved"), CTRLDocumentable::SaveDocumentCache(CTRLDocumentable::BuildDocumentCache(Model, SearchIndex, Fingerprint), Path)))
+	{
+		return false;
+	}
+
+	// Scoped so the mapping is released before the file is deleted
+	{
+		TUniquePtr< FDocCacheReader > Reader = MakeUnique< FDocCacheReader >();
+		if(TestTrue(TEXT("Mapped"), Reader->Open(Path)))
+		{
+			TestTrue(TEXT("Fingerprint"), Reader->GetFingerprint() == Fingerprint);
+
+			FGeneratedDocumentIndex Index;
+			if(TestTrue(TEXT("Index opens"), Index.Open(MoveTemp(Reader))))
+			{
+				FDocModelView const& View = Index.GetModel();
+				TestEqual(TEXT("Strings"), View.Strings.Num(), Model.NumStrings());
+				TestEqual(TEXT("Class with prefix"), Index.FindClass(TEXT("UHttpRequestHelper")), 0);
+				TestEqual(TEXT("Class without prefix"), Index.FindClass(TEXT("HttpRequestHelper")), 0);
+				TestEqual(TEXT("Unknown class"), Index.FindClass(TEXT("HttpRequest")), (int32)INDEX_NONE);
+				TestEqual(TEXT("Struct without prefix"), Index.FindStruct(TEXT("RequestOptions")), 0);
+				TestEqual(TEXT("Enum"), Index.FindEnum(TEXT("EHttpVerb")), 0);
+
+				if(TestEqual(TEXT("Class nodes"), View.GetClassNodes(View.Classes[0]).Num(), 1))
+				{
+					FDocNode const& Node = View.Nodes[View.GetClassNodes(View.Classes[0])[0]];
+					TestEqual(TEXT("Node function"), FString(View.GetString(Node.Function)), FString(TEXT("/Script/Net.HttpRequestHelper:SendRequest")));
+				}
+
+				TArrayView< const FDocTypeUsage > Usages = Index.FindTypeUsages(TEXT("FRequestOptions"));
+				if(TestEqual(TEXT("Type usages"), Usages.Num(), 2))
+				{
+					TestTrue(TEXT("Property usage first"), Usages[0].Role == EDocTypeRole::Property && Usages[0].Owner == 0);
+					TestTrue(TEXT("Parameter usage"), Usages[1].Role == EDocTypeRole::Parameter && Usages[1].Parameter == 0);
+				}
+				TestEqual(TEXT("Templates are not types"), Index.FindTypeUsages(TEXT("TArray")).Num(), 0);
+
+				TArray< FDocSearchEntry > Hits;
+				Index.Search(TEXT("send request"), 10, Hits);
+				TestTrue(TEXT("Search"), Hits.ContainsByPredicate([](FDocSearchEntry const& Hit) { return Hit.Kind == EDocEntryKind::Function && Hit.Owner == 0 && Hit.Member == 0; }));
+			}
+		}
+	}
+
+	IFileManager::Get().Delete(*Path);
+	return true;
+}
+
+
+IMPLEMENT_SIMPLE_AUTOMATION_TEST(FDocumentCacheFingerprintTest, "CTRLDocumentable.Docs.DocumentCache.Fingerprint",
+	EAutomationTestFlags::EditorContext | EAutomationTestFlags::EngineFilter)
+
+bool FDocumentCacheFingerprintTest::RunTest(FString const& Parameters)
+{
+	FGenerationSettings Settings;
+	const uint32 Fingerprint = CTRLDocumentable::GetDocumentCacheFingerprint(Settings);
+	TestTrue(TEXT("Stable"), CTRLDocumentable::GetDocumentCacheFingerprint(Settings) == Fingerprint);
+
+	FGenerationSettings Atlas = Settings;
+	Atlas.NodeAtlasSize *= 2;
+	TestTrue(TEXT("Atlas size"), CTRLDocumentable::GetDocumentCacheFingerprint(Atlas) != Fingerprint);
+
+	FGenerationSettings Sheets = Settings;
+	Sheets.bPackNodeSpriteSheets = !Sheets.bPackNodeSpriteSheets;
+	TestTrue(TEXT("Sprite sheets"), CTRLDocumentable::GetDocumentCacheFingerprint(Sheets) != Fingerprint);
+
+	FGenerationSettings Modules = Settings;
+	Modules.NativeModules.Add(TEXT("CTRLDocumentable"));
+	TestTrue(TEXT("Modules"), CTRLDocumentable::GetDocumentCacheFingerprint(Modules) != Fingerprint);
+
+	return true;
+}
+
+
+IMPLEMENT_SIMPLE_AUTOMATION_TEST(FDocumentCacheDamagedTest, "CTRLDocumentable.Docs.DocumentCache.Damaged",
+	EAutomationTestFlags::EditorContext | EAutomationTestFlags::EngineFilter)
+
+bool FDocumentCacheDamagedTest::RunTest(FString const& Parameters)
+{
+	FDocModel Model;
+	MakeCacheModel(Model);
+	FDocSearchIndex SearchIndex;
+	SearchIndex.Build(Model);
+	const TArray64< uint8 > Cache = CTRLDocumentable::BuildDocumentCache(Model, SearchIndex, 0);
+
+	{
+		FGeneratedDocumentIndex Index;
+		TestTrue(TEXT("Intact cache opens"), Index.Open(OpenBytes(Cache)));
+	}
+
+	AddExpectedError(TEXT("Documentation cache is damaged"), EAutomationExpectedErrorFlags::Contains, 2);
+
+	TArray64< uint8 > Magic = Cache;
+	Magic[0] ^= 0xFF;
+	TestFalse(TEXT("Wrong magic"), OpenBytes(MoveTemp(Magic)).IsValid());
+
+	TArray64< uint8 > Truncated = Cache;
+	Truncated.SetNum(Truncated.Num() / 2);
+	{
+		FGeneratedDocumentIndex Index;
+		TestFalse(TEXT("Sections past the end"), Index.Open(OpenBytes(MoveTemp(Truncated))));
+	}
+
+	// Well formed sections, one string id past the strings
+	FDocModel Dangling;
+	MakeCacheModel(Dangling);
+	Dangling.Properties[0].Description = Dangling.NumStrings() + 10;
+	{
+		FGeneratedDocumentIndex Index;
+		TestFalse(TEXT("String id out of range"), Index.Open(OpenBytes(CTRLDocumentable::BuildDocumentCache(Dangling, SearchIndex, 0))));
+		TestEqual(TEXT("Nothing handed out"), Index.FindClass(TEXT("UHttpRequestHelper")), (int32)INDEX_NONE);
+	}
+
+	return true;
+}
+
+#endif
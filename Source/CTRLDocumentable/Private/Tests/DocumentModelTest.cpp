@@ -0,0 +1,156 @@
+// This Source Code Form is subject to the terms of the Mozilla Public
+// License, v. 2.0. If a copy of the MPL was not distributed with this
+// file, You can obtain one at http://mozilla.org/MPL/2.0/.
+
+// Copyright (C) 2023-2025 NTY.studio. All Rights Reserved.
+
+#include "DocumentModel.h"
+#include "Misc/AutomationTest.h"
+
+#if WITH_DEV_AUTOMATION_TESTS
+
+namespace
+{
+	struct FTestNode
+	{
+		const TCHAR* DocsName;
+		const TCHAR* Title;
+	};
+
+	int32 AddClass(FDocModel& Model, int32 HierarchyIndex, std::initializer_list< const TCHAR* > Properties, std::initializer_list< const TCHAR* > Functions, std::initializer_list< FTestNode > Nodes)
+	{
+		FDocClass Class;
+		Class.ClassName = Model.Hierarchy[HierarchyIndex].ClassName;
+		Class.HierarchyIndex = HierarchyIndex;
+
+		Class.Properties = FDocRange{ Model.Properties.Num(), (int32)Properties.size() };
+		for(const TCHAR* Name : Properties)
+		{
+			Model.Properties.Add(FDocProperty{ Model.Intern(Name) });
+		}
+		Class.Functions = FDocRange{ Model.Functions.Num(), (int32)Functions.size() };
+		for(const TCHAR* Name : Functions)
+		{
+			Model.Functions.Add(FDocFunction{ Model.Intern(Name) });
+		}
+		for(FTestNode const& Node : Nodes)
+		{
+			FDocNode& Added = Model.Nodes.AddDefaulted_GetRef();
+			Added.DocsName = Model.Intern(Node.DocsName);
+			Added.ShortTitle = Model.Intern(Node.Title);
+			Class.Nodes.Add(Model.Nodes.Num() - 1);
+		}
+
+		Model.Hierarchy[HierarchyIndex].DocIndex = Model.Classes.Num();
+		return Model.Classes.Add(MoveTemp(Class));
+	}
+
+	/** "Owner.Member ..." for a run of inherited refs */
+	FString DescribeRefs(FDocModel const& Model, FDocRange Range, TFunctionRef< FDocStringId(FDocClass const&, int32) > NameOf)
+	{
+		TArray< FString > Parts;
+		for(FDocMemberRef const& Ref : FDocModel::Slice(Model.InheritedRefs, Range))
+		{
+			FDocClass const& Owner = Model.Classes[Ref.Class];
+			Parts.Add(Model.GetString(Owner.ClassName) + TEXT(".") + Model.GetString(NameOf(Owner, Ref.Index)));
+		}
+		return FString::Join(Parts, TEXT(" "));
+	}
+}
+
+
+IMPLEMENT_SIMPLE_AUTOMATION_TEST(FDocModelLinkHierarchyTest, "CTRLDocumentable.Docs.DocumentModel.LinkHierarchy",
+	EAutomationTestFlags::EditorContext | EAutomationTestFlags::EngineFilter)
+
+bool FDocModelLinkHierarchyTest::RunTest(FString const& Parameters)
+{
+	FDocModel Model;
+	const int32 Root = Model.AddHierarchyEntry(Model.Intern(TEXT("UObject")), INDEX_NONE);
+	const int32 Widget = Model.AddHierarchyEntry(Model.Intern(TEXT("UWidget")), Root);
+	const int32 Actor = Model.AddHierarchyEntry(Model.Intern(TEXT("AActor")), Root);
+	const int32 Button = Model.AddHierarchyEntry(Model.Intern(TEXT("UButton")), Widget);
+	const int32 Border = Model.AddHierarchyEntry(Model.Intern(TEXT("UBorder")), Widget);
+	Model.LinkHierarchy();
+
+	auto Children = [&Model](int32 Entry)
+	{
+		TArray< FString > Names;
+		for(int32 Child : FDocModel::Slice(Model.HierarchyChildren, Model.Hierarchy[Entry].Children))
+		{
+			Names.Add(Model.GetString(Model.Hierarchy[Child].ClassName));
+		}
+		return FString::Join(Names, TEXT(" "));
+	};
+
+	TestEqual(TEXT("Depth"), Model.Hierarchy[Button].Depth, 2);
+	TestEqual(TEXT("Root children by name"), Children(Root), FString(TEXT("AActor UWidget")));
+	TestEqual(TEXT("Widget children by name"), Children(Widget), FString(TEXT("UBorder UButton")));
+	TestEqual(TEXT("Leaf"), Children(Actor), FString());
+	TestEqual(TEXT("Every entry but the root is a child once"), Model.HierarchyChildren.Num(), Model.Hierarchy.Num() - 1);
+	TestEqual(TEXT("Parent kept"), Model.Hierarchy[Border].Parent, Widget);
+
+	return true;
+}
+
+
+IMPLEMENT_SIMPLE_AUTOMATION_TEST(FDocModelLinkInheritedMembersTest, "CTRLDocumentable.Docs.DocumentModel.LinkInheritedMembers",
+	EAutomationTestFlags::EditorContext | EAutomationTestFlags::EngineFilter)
+
+bool FDocModelLinkInheritedMembersTest::RunTest(FString const& Parameters)
+{
+	// UObject > UBase > UMiddle (not documented) > UChild > UGrandChild, and UAlpha with no documented ancestor
+	FDocModel Model;
+	const int32 Root = Model.AddHierarchyEntry(Model.Intern(TEXT("UObject")), INDEX_NONE);
+	const int32 BaseEntry = Model.AddHierarchyEntry(Model.Intern(TEXT("UBase")), Root);
+	const int32 MiddleEntry = Model.AddHierarchyEntry(Model.Intern(TEXT("UMiddle")), BaseEntry);
+	const int32 ChildEntry = Model.AddHierarchyEntry(Model.Intern(TEXT("UChild")), MiddleEntry);
+	const int32 GrandChildEntry = Model.AddHierarchyEntry(Model.Intern(TEXT("UGrandChild")), ChildEntry);
+	const int32 AlphaEntry = Model.AddHierarchyEntry(Model.Intern(TEXT("UAlpha")), Root);
+
+	// Descendants listed before their ancestors, linking must still resolve parents first
+	const int32 GrandChild = AddClass(Model, GrandChildEntry, { TEXT("Health") }, {}, {});
+	const int32 Child = AddClass(Model, ChildEntry, { TEXT("Speed") }, { TEXT("Fire") },
+		{ { TEXT("Child_Fire"), TEXT("Fire") }, { TEXT("Base_Jump"), TEXT("Jump") } });
+	const int32 Base = AddClass(Model, BaseEntry, { TEXT("Health"), TEXT("Speed") }, { TEXT("Jump"), TEXT("Fire") },
+		{ { TEXT("Base_Jump"), TEXT("Jump") }, { TEXT("Base_Fire"), TEXT("Fire") } });
+	const int32 Alpha = AddClass(Model, AlphaEntry, { TEXT("Speed") }, {}, {});
+
+	Model.LinkHierarchy();
+	Model.LinkInheritedMembers();
+
+	auto Properties = [&Model](int32 ClassIndex)
+	{
+		return DescribeRefs(Model, Model.Classes[ClassIndex].InheritedProperties, [&Model](FDocClass const& Owner, int32 Idx) { return Model.Properties[Owner.Properties.First + Idx].Name; });
+	};
+	auto Functions = [&Model](int32 ClassIndex)
+	{
+		return DescribeRefs(Model, Model.Classes[ClassIndex].InheritedFunctions, [&Model](FDocClass const& Owner, int32 Idx) { return Model.Functions[Owner.Functions.First + Idx].Name; });
+	};
+	auto Nodes = [&Model](int32 ClassIndex)
+	{
+		return DescribeRefs(Model, Model.Classes[ClassIndex].InheritedNodes, [&Model](FDocClass const& Owner, int32 Idx) { return Model.Nodes[Owner.Nodes[Idx]].DocsName; });
+	};
+
+	TestEqual(TEXT("Base inherits nothing"), Properties(Base) + Functions(Base) + Nodes(Base), FString());
+	TestEqual(TEXT("No documented ancestor"), Properties(Alpha), FString());
+
+	// Past the undocumented UMiddle, own members hiding the base's
+	TestEqual(TEXT("Child properties"), Properties(Child), FString(TEXT("UBase.Health")));
+	TestEqual(TEXT("Child functions"), Functions(Child), FString(TEXT("UBase.Jump")));
+	// Base_Fire shares its title with Child_Fire but is another node, Base_Jump is listed under the child itself
+	TestEqual(TEXT("Child nodes"), Nodes(Child), FString(TEXT("UBase.Base_Fire")));
+
+	// The nearest declaration wins, the parent's own members before what it inherited
+	TestEqual(TEXT("Grandchild properties"), Properties(GrandChild), FString(TEXT("UChild.Speed")));
+	TestEqual(TEXT("Grandchild functions"), Functions(GrandChild), FString(TEXT("UChild.Fire UBase.Jump")));
+	TestEqual(TEXT("Grandchild nodes"), Nodes(GrandChild), FString(TEXT("UChild.Child_Fire UChild.Base_Jump UBase.Base_Fire")));
+
+	// Linking again starts over rather than appending
+	const int32 NumRefs = Model.InheritedRefs.Num();
+	Model.LinkInheritedMembers();
+	TestEqual(TEXT("Relinked"), Model.InheritedRefs.Num(), NumRefs);
+
+	return true;
+}
+
+#endif
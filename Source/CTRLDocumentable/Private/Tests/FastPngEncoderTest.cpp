@@ -0,0 +1,73 @@
+// This Source Code Form is subject to the terms of the Mozilla Public
+// License, v. 2.0. If a copy of the MPL was not distributed with this
+// file, You can obtain one at http://mozilla.org/MPL/2.0/.
+
+// Copyright (C) 2023-2025 NTY.studio. All Rights Reserved.
+
+#include "Rendering/FastPngEncoder.h"
+#include "IImageWrapper.h"
+#include "IImageWrapperModule.h"
+#include "Misc/AutomationTest.h"
+#include "Math/RandomStream.h"
+#include "Modules/ModuleManager.h"
+
+#if WITH_DEV_AUTOMATION_TESTS
+
+IMPLEMENT_SIMPLE_AUTOMATION_TEST(FFastPngEncoderRoundTripTest, "CTRLDocumentable.Rendering.FastPng.RoundTrip",
+	EAutomationTestFlags::EditorContext | EAutomationTestFlags::EngineFilter)
+
+bool FFastPngEncoderRoundTripTest::RunTest(FString const& Parameters)
+{
+	IImageWrapperModule& ImageWrapperModule = FModuleManager::LoadModuleChecked< IImageWrapperModule >(TEXT("ImageWrapper"));
+
+	// Odd sizes for the row filter, long flat runs for the matcher's long lengths and far distances, noise for literals
+	const FIntPoint Sizes[] = { FIntPoint(1, 1), FIntPoint(7, 3), FIntPoint(64, 64), FIntPoint(300, 17), FIntPoint(1024, 96) };
+	FRandomStream Random(0x5EED);
+
+	for(FIntPoint const& Size : Sizes)
+	{
+		TArray64< FColor > Pixels;
+		Pixels.SetNumUninitialized((int64)Size.X * Size.Y);
+		for(int32 Y = 0; Y < Size.Y; ++Y)
+		{
+			for(int32 X = 0; X < Size.X; ++X)
+			{
+				FColor& Pixel = Pixels[(int64)Y * Size.X + X];
+				if((Y / 4) % 3 == 0)
+				{
+					Pixel = FColor(40, 40, 48, 255);
+				}
+				else if((Y / 4) % 3 == 1)
+				{
+					Pixel = FColor((uint8)X, (uint8)(X * 3), (uint8)Y, (uint8)(255 - X));
+				}
+				else
+				{
+					Pixel = FColor((uint8)Random.RandRange(0, 255), (uint8)Random.RandRange(0, 255), (uint8)Random.RandRange(0, 255), (uint8)Random.RandRange(0, 255));
+				}
+			}
+		}
+
+		TArray64< uint8 > Png;
+		CTRLDocumentable::FastPng::Encode(Pixels.GetData(), Size, Png);
+
+		TSharedPtr< IImageWrapper > Wrapper = ImageWrapperModule.CreateImageWrapper(EImageFormat::PNG);
+		TArray64< uint8 > Decoded;
+		const FString What = FString::Printf(TEXT("%dx%d"), Size.X, Size.Y);
+		if(!TestTrue(What + TEXT(" decodes"), Wrapper.IsValid() && Wrapper->SetCompressed(Png.GetData(), Png.Num()) && Wrapper->GetRaw(ERGBFormat::BGRA, 8, Decoded)))
+		{
+			continue;
+		}
+
+		TestEqual(What + TEXT(" width"), (int32)Wrapper->GetWidth(), Size.X);
+		TestEqual(What + TEXT(" height"), (int32)Wrapper->GetHeight(), Size.Y);
+		if(TestEqual(What + TEXT(" byte count"), Decoded.Num(), Pixels.Num() * (int64)sizeof(FColor)))
+		{
+			TestTrue(What + TEXT(" pixels"), FMemory::Memcmp(Decoded.GetData(), Pixels.GetData(), Decoded.Num()) == 0);
+		}
+	}
+
+	return true;
+}
+
+#endif
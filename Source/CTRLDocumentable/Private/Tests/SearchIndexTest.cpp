@@ -0,0 +1,223 @@
+// This Source Code Form is subject to the terms of the Mozilla Public
+// License, v. 2.0. If a copy of the MPL was not distributed with this
+// file, You can obtain one at http://mozilla.org/MPL/2.0/.
+
+// Copyright (C) 2023-2025 NTY.studio. All Rights Reserved.
+
+#include "Docs/SearchIndex.h"
+#include "Docs/DocumentCache.h"
+#include "DocumentModel.h"
+#include "Dom/JsonObject.h"
+#include "HAL/FileManager.h"
+#include "Misc/AutomationTest.h"
+#include "Misc/FileHelper.h"
+#include "Misc/Paths.h"
+#include "Serialization/JsonReader.h"
+#include "Serialization/JsonSerializer.h"
+
+#if WITH_DEV_AUTOMATION_TESTS
+
+namespace
+{
+	/**
+	 * Entries in build order: 0 UHttpRequestHelper, 1 RetryCount, 2 SendRequest, 3 UInventoryComponent, 4 Slot, 5 Slots, 6 FRequestOptions.
+	 * "request" is in three names and two descriptions, "slot" is a whole name once and a prefix of another.
+	 */
+	void MakeSearchModel(FDocModel& Model)
+	{
+		FDocClass Helper;
+		Helper.ClassName = Model.Intern(TEXT("UHttpRequestHelper"));
+		Helper.Path = Model.Intern(TEXT("Net/UHttpRequestHelper"));
+		Helper.Properties = FDocRange{ Model.Properties.Num(), 1 };
+		Model.Properties.Add(FDocProperty{ Model.Intern(TEXT("RetryCount")), Model.Intern(TEXT("int32")), Model.Intern(TEXT("How often a failed request is sent again")) });
+		Helper.Functions = FDocRange{ Model.Functions.Num(), 1 };
+		Model.Functions.Add(FDocFunction{ Model.Intern(TEXT("SendRequest")), Model.Intern(TEXT("Sends the request to the server")) });
+		Model.Classes.Add(MoveTemp(Helper));
+
+		FDocClass Inventory;
+		Inventory.ClassName = Model.Intern(TEXT("UInventoryComponent"));
+		Inventory.Path = Model.Intern(TEXT("Gameplay/UInventoryComponent"));
+		Inventory.Properties = FDocRange{ Model.Properties.Num(), 2 };
+		Model.Properties.Add(FDocProperty{ Model.Intern(TEXT("Slot")), Model.Intern(TEXT("int32")), Model.Intern(TEXT("The slot in use")) });
+		Model.Properties.Add(FDocProperty{ Model.Intern(TEXT("Slots")), Model.Intern(TEXT("int32")), Model.Intern(TEXT("Items held until the next request")) });
+		Model.Classes.Add(MoveTemp(Inventory));
+
+		FDocStruct Options;
+		Options.StructName = Model.Intern(TEXT("FRequestOptions"));
+		Options.Description = Model.Intern(TEXT("Options for a request"));
+		Model.Structs.Add(Options);
+	}
+
+	TSharedPtr< FJsonValue > LoadJson(FString const& Path)
+	{
+		FString Text;
+		TSharedPtr< FJsonValue > Value;
+		if(FFileHelper::LoadFileToString(Text, *Path))
+		{
+			FJsonSerializer::Deserialize(TJsonReaderFactory<>::Create(Text), Value);
+		}
+		return Value;
+	}
+}
+
+
+IMPLEMENT_SIMPLE_AUTOMATION_TEST(FDocSearchTokenizeTest, "CTRLDocumentable.Docs.SearchIndex.Tokenize",
+	EAutomationTestFlags::EditorContext | EAutomationTestFlags::EngineFilter)
+
+bool FDocSearchTokenizeTest::RunTest(FString const& Parameters)
+{
+	struct FCase
+	{
+		const TCHAR* Text;
+		bool bIdentifier;
+		TArray< FString > Expected;
+	};
+	const FCase Cases[] = {
+		// The last capital of an acronym starts the next hump
+		{ TEXT("HTTPRequest"), true, { TEXT("httprequest"), TEXT("http"), TEXT("request") } },
+		// Digits break humps, the single character ones are dropped
+		{ TEXT("GetActorLocation2D"), true, { TEXT("getactorlocation2d"), TEXT("get"), TEXT("actor"), TEXT("location") } },
+		// Underscores join an identifier and split its humps
+		{ TEXT("bIs_Valid"), true, { TEXT("bis_valid"), TEXT("is"), TEXT("valid") } },
+		// Prose is not split on humps and underscores separate its words
+		{ TEXT("Sends the HTTPRequest, a_b again!"), false, { TEXT("sends"), TEXT("the"), TEXT("httprequest"), TEXT("again") } },
+		{ TEXT(" x y "), false, {} },
+	};
+
+	for(FCase const& Case : Cases)
+	{
+		TArray< FString > Tokens;
+		FDocSearchIndex::Tokenize(Case.Text, Case.bIdentifier, Tokens);
+		TestEqual(FString::Printf(TEXT("Tokens of '%s'"), Case.Text), FString::Join(Tokens, TEXT(" ")), FString::Join(Case.Expected, TEXT(" ")));
+	}
+
+	return true;
+}
+
+
+IMPLEMENT_SIMPLE_AUTOMATION_TEST(FDocSearchScoringTest, "CTRLDocumentable.Docs.SearchIndex.Scoring",
+	EAutomationTestFlags::EditorContext | EAutomationTestFlags::EngineFilter)
+
+bool FDocSearchScoringTest::RunTest(FString const& Parameters)
+{
+	FDocModel Model;
+	MakeSearchModel(Model);
+	FDocSearchIndex Index;
+	Index.Build(Model);
+
+	// Queried as the editor does, from the tables saved in a cache
+	FDocCacheWriter Writer;
+	Index.SaveTo(Writer);
+	FDocCacheReader Reader;
+	FDocSearchIndexView View;
+	if(!TestTrue(TEXT("Cache opens"), Reader.Open(Writer.Build(0))) || !TestTrue(TEXT("Index opens"), View.Open(Reader)))
+	{
+		return false;
+	}
+	TestEqual(TEXT("Entries"), View.GetEntries().Num(), 7);
+
+	TArray< int32 > Results;
+	View.Search(TEXT("request"), 50, Results);
+	if(TestEqual(TEXT("'request' hits"), Results.Num(), 5))
+	{
+		// Names outweigh descriptions: the class, the function and the struct before both properties
+		for(int32 Idx = 0; Idx < Results.Num(); ++Idx)
+		{
+			const EDocEntryKind Kind = View.GetEntries()[Results[Idx]].Kind;
+			TestTrue(FString::Printf(TEXT("'request' hit %d in order"), Idx), (Kind != EDocEntryKind::Property) == (Idx < 3));
+		}
+	}
+
+	View.Search(TEXT("request"), 2, Results);
+	TestEqual(TEXT("Results are capped"), Results.Num(), 2);
+
+	View.Search(TEXT("slot"), 50, Results);
+	if(TestEqual(TEXT("'slot' hits"), Results.Num(), 2))
+	{
+		TestEqual(TEXT("Whole word before prefix"), Results[0], 4);
+		TestEqual(TEXT("Prefix after whole word"), Results[1], 5);
+	}
+
+	View.Search(TEXT("Send REQUEST"), 50, Results);
+	if(TestEqual(TEXT("Every word must match"), Results.Num(), 1))
+	{
+		TestEqual(TEXT("Only SendRequest has both"), Results[0], 2);
+	}
+
+	View.Search(TEXT("inv"), 50, Results);
+	TestTrue(TEXT("Prefix of a hump"), Results.Num() == 1 && Results[0] == 3);
+
+	View.Search(TEXT("u"), 50, Results);
+	TestTrue(TEXT("Single character prefix"), Results.Contains(0) && Results.Contains(3));
+
+	View.Search(TEXT("teleport"), 50, Results);
+	TestEqual(TEXT("No hits"), Results.Num(), 0);
+
+	return true;
+}
+
+
+IMPLEMENT_SIMPLE_AUTOMATION_TEST(FDocSearchShardsTest, "CTRLDocumentable.Docs.SearchIndex.Shards",
+	EAutomationTestFlags::EditorContext | EAutomationTestFlags::EngineFilter)
+
+bool FDocSearchShardsTest::RunTest(FString const& Parameters)
+{
+	FDocModel Model;
+	MakeSearchModel(Model);
+	FDocSearchIndex Index;
+	Index.Build(Model);
+
+	const FString Dir = FPaths::AutomationTransientDir() / TEXT("SearchIndexTest");
+	IFileManager::Get().DeleteDirectory(*Dir, false, true);
+	if(!TestTrue(TEXT("Written"), Index.Write(Model, Dir)))
+	{
+		return false;
+	}
+
+	TSharedPtr< FJsonValue > Manifest = LoadJson(Dir / TEXT("index.json"));
+	TSharedPtr< FJsonValue > Entries = LoadJson(Dir / TEXT("entries/0.json"));
+	TSharedPtr< FJsonValue > Shard = LoadJson(Dir / TEXT("r.json"));
+	if(TestTrue(TEXT("Files parse"), Manifest.IsValid() && Entries.IsValid() && Shard.IsValid()))
+	{
+		TestEqual(TEXT("Entry count"), (int32)Manifest->AsObject()->GetNumberField(TEXT("entryCount")), 7);
+		TestTrue(TEXT("'r' is a shard"), Manifest->AsObject()->GetArrayField(TEXT("shards")).ContainsByPredicate([](TSharedPtr< FJsonValue > const& Key) { return Key->AsString() == TEXT("r"); }));
+
+		TArray< TSharedPtr< FJsonValue > > const& EntryList = Entries->AsArray();
+		if(TestEqual(TEXT("Entries written"), EntryList.Num(), 7))
+		{
+			TestEqual(TEXT("Entry label"), EntryList[6]->AsArray()[3]->AsString(), FString(TEXT("FRequestOptions")));
+		}
+
+		// Same entries for a token in the shard as from the cache
+		TArray< TSharedPtr< FJsonValue > > const& Tokens = Shard->AsObject()->GetArrayField(TEXT("tokens"));
+		TArray< TSharedPtr< FJsonValue > > const& Postings = Shard->AsObject()->GetArrayField(TEXT("postings"));
+		const int32 TokenIdx = Tokens.IndexOfByPredicate([](TSharedPtr< FJsonValue > const& Token) { return Token->AsString() == TEXT("request"); });
+		if(TestTrue(TEXT("Token in its shard"), TokenIdx != INDEX_NONE && Postings.IsValidIndex(TokenIdx)))
+		{
+			TArray< int32 > Written;
+			TArray< TSharedPtr< FJsonValue > > const& Pairs = Postings[TokenIdx]->AsArray();
+			for(int32 Idx = 0; Idx + 1 < Pairs.Num(); Idx += 2)
+			{
+				Written.Add((int32)Pairs[Idx]->AsNumber());
+			}
+
+			FDocCacheWriter Writer;
+			Index.SaveTo(Writer);
+			FDocCacheReader Reader;
+			FDocSearchIndexView View;
+			TArray< int32 > Cached;
+			if(Reader.Open(Writer.Build(0)) && View.Open(Reader))
+			{
+				View.Search(TEXT("request"), 50, Cached);
+			}
+			Written.Sort();
+			Cached.Sort();
+			TestTrue(TEXT("Shard matches cache"), Written.Num() > 0 && Written == Cached);
+		}
+	}
+
+	IFileManager::Get().DeleteDirectory(*Dir, false, true);
+	return true;
+}
+
+#endif
@@ -12,6 +12,8 @@
 #include "Modules/ModuleManager.h"
 
 class FUICommandList;
+class FNodeImageServer;
+class IDocumentIndex;
 
 
 class FCTRLDocumentableModule : public IModuleInterface
@@ -25,12 +27,29 @@ public:
 public:
 	void GenerateDocs(struct FGenerationSettings const& Settings);
 
+	/** Game thread only. Starts the deferred node image server, or hands back the running one if the port matches. */
+	TSharedPtr< FNodeImageServer > GT_GetNodeImageServer(FGenerationSettings const& Settings);
+
+	/**
+	 * Game thread only. The documentation of the last finished generation, read back from its cache on first use after a restart. Null if there is none.
+	 * Don't hold on to it past the next generation: read back from the cache it keeps the file mapped, which stops the next one replacing it.
+	 */
+	TSharedPtr< const IDocumentIndex > GetDocumentIndex() const;
+	/** Game thread only. Called by the generator once a task's docs are complete. */
+	void GT_SetDocumentIndex(TSharedPtr< const IDocumentIndex > InIndex);
+
 protected:
 	void ProcessIntermediateDocs(FString const& IntermediateDir, FString const& OutputDir, FString const& DocTitle, bool bCleanOutput);
 	void ShowUI();
+	/** Docs of the last session's generation, if it was run with the current settings and engine. */
+	TSharedPtr< const IDocumentIndex > GT_LoadDocumentCache() const;
 
 protected:
 	TUniquePtr< FTaskProcessor > Processor;
+	TSharedPtr< FNodeImageServer > NodeImageServer;
+	/** Filled from the cache on first request */
+	mutable TSharedPtr< const IDocumentIndex > DocumentIndex;
+	mutable bool bTriedDocumentCache = false;
 
 	TSharedPtr< FUICommandList > UICommands;
 };
@@ -0,0 +1,44 @@
+// This Source Code Form is subject to the terms of the Mozilla Public
+// License, v. 2.0. If a copy of the MPL was not distributed with this
+// file, You can obtain one at http://mozilla.org/MPL/2.0/.
+
+// Copyright (C) 2023-2025 NTY.studio. All Rights Reserved.
+
+#pragma once
+
+#include "CoreMinimal.h"
+#include "DocumentModel.h"
+
+class UFunction;
+
+
+/**
+ * Lookups over the documentation of a finished generation, for editor tooling and scripts.
+ * Immutable once published, so safe to read from any thread while a reference is held.
+ */
+class IDocumentIndex
+{
+public:
+	virtual ~IDocumentIndex() {}
+
+	/** The documentation itself, lookups return indices into it. Its views live as long as the index. */
+	virtual FDocModelView const& GetModel() const = 0;
+
+	/** Index in GetModel().Classes of the class with this name, with or without its U/A prefix. INDEX_NONE if it isn't documented. */
+	virtual int32 FindClass(FStringView ClassName) const = 0;
+
+	/** Index in GetModel().Structs of the struct with this name, with or without its F prefix. INDEX_NONE if it isn't documented. */
+	virtual int32 FindStruct(FStringView StructName) const = 0;
+
+	/** Index in GetModel().Enums of the enum with this name, with or without its E prefix. INDEX_NONE if it isn't documented. */
+	virtual int32 FindEnum(FStringView EnumName) const = 0;
+
+	/** Indices in GetModel().Nodes of the nodes calling Function. */
+	virtual void FindNodesForFunction(const UFunction* Function, TArray< int32 >& OutNodes) const = 0;
+
+	/** Whatever matches every word of Query as a word or the start of one, best first. */
+	virtual void Search(FStringView Query, int32 MaxResults, TArray< FDocSearchEntry >& OutEntries) const = 0;
+
+	/** Everywhere TypeName appears in a property, parameter, return or struct member type. */
+	virtual TArrayView< const FDocTypeUsage > FindTypeUsages(FStringView TypeName) const = 0;
+};
@@ -0,0 +1,364 @@
+// This Source Code Form is subject to the terms of the Mozilla Public
+// License, v. 2.0. If a copy of the MPL was not distributed with this
+// file, You can obtain one at http://mozilla.org/MPL/2.0/.
+
+// Copyright (C) 2023-2025 NTY.studio. All Rights Reserved.
+
+#pragma once
+
+#include "CoreMinimal.h"
+
+
+/** Index of an interned string in FDocModel. 0 is always the empty string. */
+typedef int32 FDocStringId;
+
+/** Which part of its source text a localized string is, so it can be derived again in another culture. */
+enum class EDocTextPart : uint8
+{
+	Whole,
+	/** The first LineCount lines */
+	FirstLines,
+	/** Sections of the doc comment the text holds */
+	Summary,
+	Param,
+	Return,
+};
+
+struct FDocTextSource
+{
+	FText Text;
+	EDocTextPart Part = EDocTextPart::Whole;
+	int32 LineCount = 0;
+	FString ParamName;
+};
+
+/** A run of consecutive entries in one of FDocModel's flat arrays. */
+struct FDocRange
+{
+	int32 First = 0;
+	int32 Num = 0;
+};
+
+struct FDocProperty
+{
+	FDocStringId Name = 0;
+	FDocStringId Type = 0;
+	FDocStringId Description = 0;
+	/** Into FDocModel::StringLists */
+	FDocRange Flags;
+};
+
+struct FDocParameter
+{
+	FDocStringId Name = 0;
+	FDocStringId Type = 0;
+	FDocStringId Description = 0;
+	/** Into FDocModel::StringLists */
+	FDocRange Flags;
+};
+
+struct FDocFunction
+{
+	FDocStringId Name = 0;
+	FDocStringId Description = 0;
+	FDocStringId ReturnType = 0;
+	FDocStringId ReturnDescription = 0;
+	/** Into FDocModel::StringLists */
+	FDocRange Flags;
+	/** Into FDocModel::Parameters */
+	FDocRange Parameters;
+};
+
+struct FDocPin
+{
+	FDocStringId Name = 0;
+	FDocStringId Type = 0;
+	FDocStringId Description = 0;
+	/** Into FDocModel::StringLists, the contexts the pin shows in. Empty when it shows in all of them. */
+	FDocRange Contexts;
+};
+
+struct FDocNode
+{
+	FDocStringId DocsName = 0;
+	FDocStringId ClassId = 0;
+	FDocStringId ClassName = 0;
+	FDocStringId ShortTitle = 0;
+	FDocStringId FullTitle = 0;
+	FDocStringId Description = 0;
+	FDocStringId ImgPath = 0;
+	/** Into FDocModel::Pins */
+	FDocRange Inputs;
+	FDocRange Outputs;
+	/** Into FDocModel::StringLists, contexts the node can't be placed in */
+	FDocRange UnavailableIn;
+	/** Path name of the function a call node calls, to find nodes by function */
+	FDocStringId Function = 0;
+
+	bool bImgDeferred = false;
+	bool bImgPending = false;
+
+	/** Filled in once the image has been drawn, zero size if it never was. */
+	FIntPoint ImageSize = FIntPoint::ZeroValue;
+	FDocStringId Placeholder = 0;
+	FDocStringId ThumbPath = 0;
+
+	bool bHasSprite = false;
+	FIntRect SpriteRect;
+	FIntPoint SheetSize = FIntPoint::ZeroValue;
+};
+
+/** A class in the task's inheritance table, either documented itself or an ancestor of one that is. */
+struct FDocHierarchyEntry
+{
+	FDocStringId ClassName = 0;
+	/** Into FDocModel::Hierarchy, INDEX_NONE for a root class */
+	int32 Parent = INDEX_NONE;
+	int32 Depth = 0;
+	/** Into FDocModel::Classes, INDEX_NONE when only an ancestor */
+	int32 DocIndex = INDEX_NONE;
+	/** Into FDocModel::HierarchyChildren, set by LinkHierarchy */
+	FDocRange Children;
+};
+
+enum class EDocTypeRole : uint8
+{
+	Property,
+	Parameter,
+	Return,
+	StructMember,
+};
+
+/** One place a type is named: a class member, a function signature or a struct member. */
+struct FDocTypeUsage
+{
+	FDocStringId Type = 0;
+	EDocTypeRole Role = EDocTypeRole::Property;
+	/** Into FDocModel::Classes, or FDocModel::Structs for struct members */
+	int32 Owner = INDEX_NONE;
+	/** Into the owner's own properties or functions */
+	int32 Member = INDEX_NONE;
+	/** Into the function's parameters, for parameter usages */
+	int32 Parameter = INDEX_NONE;
+};
+
+enum class EDocEntryKind : uint8
+{
+	Class,
+	Property,
+	Function,
+	Node,
+	Struct,
+	Enum,
+};
+
+/** Something search can find. Owner and Member index the model the same way the output does. */
+struct FDocSearchEntry
+{
+	EDocEntryKind Kind = EDocEntryKind::Class;
+	/** Into FDocModel::Classes, or Structs / Enums for those kinds */
+	int32 Owner = INDEX_NONE;
+	/** Into the owner's own property, function or node list, INDEX_NONE for the owner itself */
+	int32 Member = INDEX_NONE;
+	FDocStringId Label = 0;
+};
+
+/** A member documented under another class: index in that class's own list of the member kind. */
+struct FDocMemberRef
+{
+	/** Into FDocModel::Classes */
+	int32 Class = INDEX_NONE;
+	int32 Index = INDEX_NONE;
+};
+
+struct FDocClass
+{
+	FDocStringId ClassName = 0;
+	FDocStringId Path = 0;
+	/** Into FDocModel::Hierarchy */
+	int32 HierarchyIndex = INDEX_NONE;
+	/** Into FDocModel::Properties */
+	FDocRange Properties;
+	/** Into FDocModel::Functions */
+	FDocRange Functions;
+	/** Into FDocModel::Nodes. Nodes arrive in spawner order, not grouped by class, so these are indices. */
+	TArray< int32 > Nodes;
+	/** Into FDocModel::InheritedRefs, members of documented ancestors not hidden by a nearer class. Set by LinkInheritedMembers. */
+	FDocRange InheritedProperties;
+	FDocRange InheritedFunctions;
+	FDocRange InheritedNodes;
+};
+
+/** FDocClass as a finished model keeps it, with its nodes as a range into one shared list. */
+struct FDocClassRecord
+{
+	FDocStringId ClassName = 0;
+	FDocStringId Path = 0;
+	int32 HierarchyIndex = INDEX_NONE;
+	FDocRange Properties;
+	FDocRange Functions;
+	/** Into FDocModelView::ClassNodes */
+	FDocRange Nodes;
+	FDocRange InheritedProperties;
+	FDocRange InheritedFunctions;
+	FDocRange InheritedNodes;
+};
+
+struct FDocStruct
+{
+	FDocStringId StructName = 0;
+	FDocStringId Path = 0;
+	FDocStringId SuperStruct = 0;
+	FDocStringId Description = 0;
+	/** Into FDocModel::Properties, own members only */
+	FDocRange Properties;
+};
+
+struct FDocEnumValue
+{
+	FDocStringId Name = 0;
+	FDocStringId DisplayName = 0;
+	FDocStringId Description = 0;
+	int64 Value = 0;
+};
+
+struct FDocEnum
+{
+	FDocStringId EnumName = 0;
+	FDocStringId Path = 0;
+	FDocStringId Description = 0;
+	/** Into FDocModel::EnumValues */
+	FDocRange Values;
+};
+
+/**
+ * Everything a generation run documents, as plain structs in flat arrays with interned strings.
+ * Nothing is turned into JSON until the output is written.
+ * Not thread safe; owned and filled by one task at a time.
+ */
+class FDocModel
+{
+public:
+	FDocModel();
+
+public:
+	FDocStringId Intern(FString const& String);
+	/** Id of String if the model has it, 0 otherwise. Doesn't add it. */
+	FDocStringId FindString(FStringView String) const;
+	/** Intern String and remember the text it came from, for the per-culture string tables. Culture invariant texts are plain strings. */
+	FDocStringId InternText(FString const& String, FDocTextSource const& Source);
+	FDocStringId InternText(FText const& Text);
+	FString const& GetString(FDocStringId Id) const { return Strings[Id]; }
+	/** Including the empty string at id 0 */
+	int32 NumStrings() const { return Strings.Num(); }
+
+	FDocRange AddStringList(TArrayView< const FDocStringId > List);
+
+	/**
+	 * Nodes have no description of their own, the viewer shows the menu category they are listed under ("Top|Sub|Leaf").
+	 * The generator sets it here and search reads it back through GetNodeCategory, so the choice lives in one place.
+	 */
+	void SetNodeDescription(FDocNode& Node, FText const& MenuCategory);
+	static FDocStringId GetNodeCategory(FDocNode const& Node) { return Node.Description; }
+
+	/** Add a class to the inheritance table below Parent, which must already be in it. */
+	int32 AddHierarchyEntry(FDocStringId ClassName, int32 Parent);
+	/** Fill in the child lists of the inheritance table, sorted by name. Call once the classes are all in. */
+	void LinkHierarchy();
+	/**
+	 * Fill in each class's inherited members, nearest declaration winning when names clash.
+	 * Ancestors are resolved first so every class only extends its parent's list. Call once the nodes are all in.
+	 */
+	void LinkInheritedMembers();
+
+	/** Record every type named in CppType as used by Usage: the element types of containers and pointers, not the templates or primitives themselves. */
+	void AddTypeUsages(FString const& CppType, FDocTypeUsage const& Usage);
+
+	template < typename T >
+	static TArrayView< const T > Slice(TArray< T > const& Array, FDocRange Range)
+	{
+		return TArrayView< const T >(Array.GetData() + Range.First, Range.Num);
+	}
+
+	/** The viewer's nodes.json: { "nodes": [ class, ... ], "hierarchy": { ... }, "structs": [ ... ], "enums": [ ... ] } */
+	FString ToNodesJson() const;
+
+	void Reset();
+
+public:
+	TArray< FDocClass > Classes;
+	TArray< FDocHierarchyEntry > Hierarchy;
+	TArray< int32 > HierarchyChildren;
+	TArray< FDocMemberRef > InheritedRefs;
+	/** In the order members were documented, not grouped by type */
+	TArray< FDocTypeUsage > TypeUsages;
+	TArray< FDocProperty > Properties;
+	TArray< FDocFunction > Functions;
+	TArray< FDocParameter > Parameters;
+	TArray< FDocNode > Nodes;
+	TArray< FDocPin > Pins;
+	TArray< FDocStruct > Structs;
+	TArray< FDocEnum > Enums;
+	TArray< FDocEnumValue > EnumValues;
+	TArray< FDocStringId > StringLists;
+	/** Localizable strings and where they came from. First source recorded for a string wins. */
+	TMap< FDocStringId, FDocTextSource > TextSources;
+
+protected:
+	TArray< FString > Strings;
+	/** String hash to indices into Strings, so each string is stored once. */
+	TMultiMap< uint32, FDocStringId > StringsByHash;
+};
+
+/** Strings as one block of chars, each found by where it starts. One offset past the end closes the last string. */
+struct FDocStringsView
+{
+	int32 Num() const { return FMath::Max(Offsets.Num() - 1, 0); }
+	FStringView Get(int32 Idx) const { return FStringView(Chars.GetData() + Offsets[Idx], Offsets[Idx + 1] - Offsets[Idx]); }
+	/** Offsets rising within Chars. Check once before handing out strings read from disk. */
+	bool IsValid() const;
+
+	TArrayView< const int32 > Offsets;
+	TArrayView< const TCHAR > Chars;
+};
+
+/**
+ * A finished model read where it lies, as the document cache lays it out: class node lists are ranges into ClassNodes,
+ * strings are views into one block of chars and type usages come grouped by type. Ids and indices mean what they do
+ * in FDocModel. Valid only while whatever holds the tables is kept alive.
+ */
+struct FDocModelView
+{
+	FStringView GetString(FDocStringId Id) const { return Strings.Get(Id); }
+	TArrayView< const int32 > GetClassNodes(FDocClassRecord const& Class) const { return Slice(ClassNodes, Class.Nodes); }
+
+	/** Every range, index and string id points inside its table. Check once before handing out a view read from disk. */
+	bool IsValid() const;
+	/** Entry's owner, member and label are in this model. */
+	bool IsValid(FDocSearchEntry const& Entry) const;
+
+	template < typename T >
+	static TArrayView< const T > Slice(TArrayView< const T > Array, FDocRange Range)
+	{
+		return Array.Slice(Range.First, Range.Num);
+	}
+
+	/** Including the empty string at id 0 */
+	FDocStringsView Strings;
+	TArrayView< const FDocClassRecord > Classes;
+	TArrayView< const int32 > ClassNodes;
+	TArrayView< const FDocHierarchyEntry > Hierarchy;
+	TArrayView< const int32 > HierarchyChildren;
+	TArrayView< const FDocMemberRef > InheritedRefs;
+	/** Grouped by type, documentation order kept within each type */
+	TArrayView< const FDocTypeUsage > TypeUsages;
+	TArrayView< const FDocProperty > Properties;
+	TArrayView< const FDocFunction > Functions;
+	TArrayView< const FDocParameter > Parameters;
+	TArrayView< const FDocNode > Nodes;
+	TArrayView< const FDocPin > Pins;
+	TArrayView< const FDocStruct > Structs;
+	TArrayView< const FDocEnum > Enums;
+	TArrayView< const FDocEnumValue > EnumValues;
+	TArrayView< const FDocStringId > StringLists;
+};
@@ -9,6 +9,9 @@
 #include "Modules/ModuleManager.h"
 #include "CoreMinimal.h"
 #include "GameFramework/Actor.h"
+#include "GenerationSettings.h"
+#include "Async/TaskGraphInterfaces.h"
+#include <atomic>
 
 
 class UClass;
@@ -19,11 +22,18 @@ class UK2Node;
 class UBlueprintNodeSpawner;
 class FXmlFile;
 class FXmlNode;
+class FNodeImageRenderer;
+class FNodeSpriteSheetBuilder;
+class FNodeImageServer;
+class FDocModel;
+class FDocCommentCache;
+class FFieldTextCache;
+class FPinDocExtractor;
+struct FDocComment;
 class FDocumentationGenerator
 {
 public:
-	FDocumentationGenerator()
-	{}
+	FDocumentationGenerator();
 	~FDocumentationGenerator();
 
 public :
@@ -31,43 +41,152 @@ public :
 	{
 		FString RelImageBasePath;
 		FString ImageFilename;
+		FString ImageAbsolutePath;
 		UClass  *AssociatedClass;
+		TWeakObjectPtr< UBlueprintNodeSpawner > Spawner;
+		TWeakObjectPtr< UObject > SourceObject;
+		bool bImageDeferred;
+		bool bImagePending;
+
+		/** The node spawned in a further context, null where it isn't available there. */
+		struct FContextVariant
+		{
+			TWeakObjectPtr< UClass > ContextClass;
+			UK2Node* Node = nullptr;
+		};
+		/** Only the contexts where the node differs from the one in the main context. */
+		TArray< FContextVariant > ContextVariants;
+
 		FNodeProcessingState():
 			RelImageBasePath(),
-			ImageFilename()
+			ImageFilename(),
+			ImageAbsolutePath(),
+			bImageDeferred(false),
+			bImagePending(false)
 		{}
 	};
 
 public:
 	/** Callable only from game thread */
-	bool GT_Init(FString const& InDocsTitle, FString const& InOutputDir, UClass* BlueprintContextClass = AActor::StaticClass());
+	bool GT_Init(FGenerationSettings const& InSettings, FString const& InOutputDir);
+	void GT_Invalidate();
 	UK2Node* GT_InitializeForSpawner(UBlueprintNodeSpawner* Spawner, UObject* SourceObject, FNodeProcessingState& OutState);
 	bool GT_Finalize(FString OutputPath);
+	bool GT_RenderNodeImage(UBlueprintNodeSpawner* Spawner, UObject* SourceObject, FString const& Filename, TUniqueFunction< void(TArray< uint8 >&&) >&& OnDone);
+	bool GT_HasFreeImageSlot() const;
+	void GT_PumpNodeImages();
 	/**/
 
-	/** Callable from background thread */
+	/** Images of this run are left to the server and drawn when first requested. Set before generating. */
+	void SetNodeImageServer(TSharedPtr< FNodeImageServer > InServer);
+	static FString GetImageRootDir();
+	static FString GetClassDocId(UClass* Class);
+	/** Parsed tooltip of Function, cached until the text caches are reset. Thread safe. */
+	FDocComment const& GetDocComment(const UFunction* Function);
+	/** Localized field texts shared by everything a task documents. Thread safe. */
+	FFieldTextCache& GetFieldTexts() { return *FieldTexts; }
+	/** Texts may have been edited since the last task, call at the start of each. */
+	void ResetTextCaches();
+
+	/** Callable from background thread. Never from the game thread: image waits depend on its tick. */
+	void PlanNodeImage(UEdGraphNode* Node, FNodeProcessingState& State);
 	bool GenerateNodeImage(UEdGraphNode* Node, FNodeProcessingState& State);
-	bool GenerateNodeDocs(UK2Node* Node, FNodeProcessingState& State, FJsonObject& ObjectMeta);
+	void WaitForNodeImageSlot();
+	void SubmitNodeImageBatch();
+	void FlushNodeImages();
+	/** Drop queued and in flight node images without drawing or writing them, for a cancelled task. */
+	void DiscardNodeImages();
+	void SealSpriteSheets();
+	/**
+	 * Fills in image details of the nodes GenerateNodeDocs added to Model. Before bRunComplete, images bound for sprite
+	 * sheets are left pending and false is returned, as the sheets are only packed once.
+	 */
+	bool FinalizeNodeImages(FDocModel& Model, bool bRunComplete);
+	bool OptimizeNodeImages(TFunctionRef< bool() > ShouldCancel);
+	bool GenerateNodeDocs(UK2Node* Node, FNodeProcessingState& State, FDocModel& Model, int32& OutNodeIndex);
 	/**/
 
 protected:
+	struct FGraphContext
+	{
+		TWeakObjectPtr< UBlueprint > DummyBP;
+		TWeakObjectPtr< UEdGraph > Graph;
+		TSharedPtr< class SGraphPanel > GraphPanel;
+	};
+
+	bool GT_AcquireGraphContext(UClass* ContextClass);
+	void GT_ResetGraph();
+	void GT_SpawnContextVariants(UBlueprintNodeSpawner* Spawner, UK2Node* Node, FNodeProcessingState& State);
+	static bool IsContextSensitive(UK2Node* Node);
+	static bool HasSamePins(UK2Node* A, UK2Node* B);
+	void GT_ReleaseGraphContext(FGraphContext& Context);
 	void CleanUp();
+	void PumpNodeImageReadbacks();
+	void QueueNodeImageWrite(TArray64< FColor >&& Pixels, FIntPoint Size, FString const& Filename, FString const& NodeName);
+	static bool TrimNodeImage(TArray64< FColor >& Pixels, FIntPoint& Size);
 
 	FString GetFunctionFlags(UFunction *InFunction);
-	FString ExtractFunctionDescription(const FString& FunctionTooltip);
-	FString ExtractFunctionParamDescription(const FString &FunctionTooltip, const FString &ParamName, const FString& DefaultTooltip, bool ExtractReturnInfo = false);
-	FString JoinArrayOfStrings(const TArray<FString>& Array, int Start = 0, bool AddLineEndings = true);
 	static void AdjustNodeForSnapshot(UEdGraphNode* Node);
-	static FString GetClassDocId(UClass* Class);
 	static FString GetNodeDocId(UEdGraphNode* Node);
 	static UClass* MapToAssociatedClass(UK2Node* NodeInst, UObject* Source);
 	static bool IsSpawnerDocumentable(UBlueprintNodeSpawner* Spawner, bool bIsBlueprint);
 
 protected:
+	/** Warm graphs, one per blueprint context class, kept until invalidated. DummyBP, Graph and GraphPanel point at the active one. */
+	TMap< TWeakObjectPtr< UClass >, FGraphContext > GraphContexts;
+
 	TWeakObjectPtr< UBlueprint > DummyBP;
 	TWeakObjectPtr< UEdGraph > Graph;
 	TSharedPtr< class SGraphPanel > GraphPanel;
 
+	/** Further contexts of this run, nodes are only spawned in them to see whether they differ. */
+	TArray< TPair< TWeakObjectPtr< UClass >, TWeakObjectPtr< UEdGraph > > > OtherContexts;
+	TUniquePtr< FNodeImageRenderer > ImageRenderer;
+	TUniquePtr< FFieldTextCache > FieldTexts;
+	TUniquePtr< FDocCommentCache > DocComments;
+	TUniquePtr< FPinDocExtractor > PinDocs;
+	FIntPoint RendererAtlasSize = FIntPoint::ZeroValue;
+	int32 RendererMaxInFlight = 0;
+
+	/** Background write tasks for node images whose readback has completed. Only touched by the processor thread. */
+	FGraphEventArray PendingImageWrites;
+
+	struct FBatchedNodeImage
+	{
+		UEdGraphNode* Node;
+		FString NodeName;
+		FString Filename;
+	};
+
+	/** Nodes waiting to be drawn together into the next atlas. */
+	TArray< FBatchedNodeImage > PendingBatch;
+
+	TUniquePtr< FNodeSpriteSheetBuilder > SpriteSheets;
+	TSharedPtr< FNodeImageServer > ImageServer;
+
+	/** What is only known once a node image has been trimmed, filled in by the write tasks. */
+	struct FNodeImageResult
+	{
+		FIntPoint Size = FIntPoint::ZeroValue;
+		FString Placeholder;
+		FString ThumbFilename;
+
+		/** Set once the image has been packed, empty if it was written on its own. */
+		FString SheetFilename;
+		FIntPoint SheetSize = FIntPoint::ZeroValue;
+		FIntRect SpriteRect;
+	};
+
+	/** Keyed by the absolute path the node image would be written to. */
+	TMap< FString, FNodeImageResult > ImageResults;
+	FCriticalSection ImageResultsLock;
+	/** Node images that reached the disk this run, or a sprite sheet on its way there */
+	std::atomic< int32 > NumNodeImagesWritten { 0 };
+
+	/** Indices of node docs waiting for their image results, keyed like ImageResults. */
+	TMap< FString, int32 > PendingImageNodes;
+
+	FGenerationSettings Settings;
 	FString DocsTitle;
 	FString OutputDir;
 
@@ -15,6 +15,24 @@
 #include "GenerationSettings.generated.h"
 
 
+UENUM()
+enum class ENodeImageFormat : uint8
+{
+	/** Snapshot the real node widget through Slate and the GPU, written as PNG. */
+	Raster,
+	/** Draw the node procedurally as SVG on worker threads. Needs no GPU, works with -nullrhi. */
+	Vector,
+};
+
+UENUM()
+enum class ENodeImageEncoder : uint8
+{
+	/** Built-in single pass PNG encoder, tuned for encode latency over file size. */
+	Fast,
+	/** The engine's image writer (zlib), slower but slightly smaller. */
+	Engine,
+};
+
 USTRUCT()
 struct FGenerationSettings
 {
@@ -26,6 +44,17 @@ public:
 
 	UPROPERTY(EditAnywhere, Category = "Documentation" )
 	bool StartNodeServer;
+
+	/** Publish the text docs as soon as they're ready, with node images marked pending and filled in by a second pass. */
+	UPROPERTY(EditAnywhere, Category = "Documentation")
+	bool bPublishTextFirst;
+
+	/**
+	 * Further cultures to publish, e.g. de, fr, ja. The docs are generated once in the editor's language and
+	 * a string table translating their localized texts is written for each of these.
+	 */
+	UPROPERTY(EditAnywhere, Category = "Documentation")
+	TArray< FString > AdditionalCultures;
 		
 	/** List of C++ modules in which to search for blueprint-exposed classes to document. */
 	UPROPERTY(EditAnywhere, Category = "Class Search", Meta = (Tooltip = "Raw module names (Do not prefix with '/Script')."))
@@ -38,13 +67,78 @@ public:
 	UPROPERTY(EditAnywhere, Category = "Class Search", AdvancedDisplay)
 	TSubclassOf< UObject > BlueprintContextClass;
 
-	
+	/**
+	 * Further blueprint classes to document nodes for, e.g. Object or UserWidget. Nodes are still generated once in
+	 * BlueprintContextClass; the docs only note where a node or its pins differ in these contexts.
+	 */
+	UPROPERTY(EditAnywhere, Category = "Class Search", AdvancedDisplay)
+	TArray< TSubclassOf< UObject > > AdditionalContextClasses;
+
+	UPROPERTY(EditAnywhere, Category = "Images")
+	ENodeImageFormat NodeImageFormat;
+
+	UPROPERTY(EditAnywhere, Category = "Images", Meta = (EditCondition = "NodeImageFormat == ENodeImageFormat::Raster"))
+	ENodeImageEncoder NodeImageEncoder;
+
+	/** Pack each class's node images into a few shared sheets and record every node's rect in the class data. */
+	UPROPERTY(EditAnywhere, Category = "Images", Meta = (EditCondition = "NodeImageFormat == ENodeImageFormat::Raster"))
+	bool bPackNodeSpriteSheets;
+
+	/**
+	 * Skip drawing node images during generation. The editor serves them on NodeImageServerPort instead and draws
+	 * each one the first time the viewer asks for it, keeping the result on disk. Requires the editor to stay open.
+	 */
+	UPROPERTY(EditAnywhere, Category = "Images", Meta = (EditCondition = "NodeImageFormat == ENodeImageFormat::Raster"))
+	bool bRenderNodeImagesOnDemand;
+
+	UPROPERTY(EditAnywhere, Category = "Images", AdvancedDisplay, Meta = (EditCondition = "bRenderNodeImagesOnDemand", ClampMin = "1024", ClampMax = "65535"))
+	int32 NodeImageServerPort;
+
+	/** Embed a tiny blurred preview of every node image in the node data, shown while the real image loads. */
+	UPROPERTY(EditAnywhere, Category = "Images")
+	bool bEmbedImagePlaceholders;
+
+	/** Also write a downscaled copy of each node image no wider than this for list views. 0 disables thumbnails. */
+	UPROPERTY(EditAnywhere, Category = "Images", Meta = (EditCondition = "NodeImageFormat == ENodeImageFormat::Raster && !bPackNodeSpriteSheets", ClampMin = "0", ClampMax = "1024"))
+	int32 NodeThumbnailWidth;
+
+	/**
+	 * Optional command run once over the image folder after generation, e.g. to squeeze PNGs for a release publish.
+	 * {dir} is replaced with the image directory. Quote the executable if its path has spaces.
+	 * Example: "C:/Program Files/oxipng/oxipng.exe" -o max --strip safe -r "{dir}"
+	 */
+	UPROPERTY(EditAnywhere, Category = "Images", AdvancedDisplay)
+	FString ImageOptimizerCommand;
+
+	/** Number of node images that may be waiting on a GPU readback at the same time. */
+	UPROPERTY(EditAnywhere, Category = "Images", AdvancedDisplay, Meta = (ClampMin = "1", ClampMax = "64"))
+	int32 MaxNodeImagesInFlight;
+
+	/** Draw the node widgets of each class into shared atlas targets, one render pass and readback per atlas. */
+	UPROPERTY(EditAnywhere, Category = "Images", AdvancedDisplay)
+	bool bBatchNodeImages;
+
+	/** Edge length in pixels of the atlas targets used when batching node images, also the maximum sprite sheet size. */
+	UPROPERTY(EditAnywhere, Category = "Images", AdvancedDisplay, Meta = (EditCondition = "bBatchNodeImages", ClampMin = "512", ClampMax = "8192"))
+	int32 NodeAtlasSize;
+
 
 
 public:
 	FGenerationSettings()
 	{
 		BlueprintContextClass = AActor::StaticClass();
+		bPublishTextFirst = false;
+		NodeImageFormat = ENodeImageFormat::Raster;
+		NodeImageEncoder = ENodeImageEncoder::Fast;
+		bPackNodeSpriteSheets = false;
+		bEmbedImagePlaceholders = true;
+		bRenderNodeImagesOnDemand = false;
+		NodeImageServerPort = 3027;
+		NodeThumbnailWidth = 0;
+		MaxNodeImagesInFlight = 8;
+		bBatchNodeImages = true;
+		NodeAtlasSize = 2048;
 	}
 
 	bool HasAnySources() const
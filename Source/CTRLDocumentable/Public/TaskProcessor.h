@@ -14,21 +14,24 @@
 #include "Containers/Queue.h"
 #include "CoreMinimal.h"
 #include "DocumentationGenerator.h"
+#include "DocumentModel.h"
 
 class ISourceObjectEnumerator;
+class FDocSearchIndex;
 
 class UBlueprintNodeSpawner;
+class UK2Node;
 
 
 class FTaskProcessor: public FRunnable
 {
 public:
 	FTaskProcessor();
+	virtual ~FTaskProcessor();
 
 public:
 	void QueueTask(FGenerationSettings const& Settings);
 	bool IsRunning() const;
-	static TArray<TSharedPtr<FJsonValue>> Classes;
 
 public:
 	virtual bool Init() override;
@@ -36,7 +39,9 @@ public:
 	virtual void Exit() override;
 	virtual void Stop() override;
 	virtual bool ProcessClass(UClass* Class);
-	virtual TSharedRef<FJsonObject> SerializeClassInfo(UClass *Class); 
+	virtual int32 SerializeClassInfo(UClass *Class, FDocModel& Model); 
+	virtual int32 SerializeStructInfo(UScriptStruct* Struct, FDocModel& Model);
+	virtual int32 SerializeEnumInfo(UEnum* Enum, FDocModel& Model);
 
 protected:
 	struct FGenTask
@@ -45,6 +50,13 @@ protected:
 		TSharedPtr< class SNotificationItem > Notification;
 	};
 
+	struct FPendingNodeImage
+	{
+		UK2Node* Node;
+		FDocumentationGenerator::FNodeProcessingState State;
+		int32 NodeIndex;
+	};
+
 	struct FGenCurrentTask
 	{
 		TSharedPtr< FGenTask > Task;
@@ -57,7 +69,22 @@ protected:
 		TWeakObjectPtr< UObject > SourceObject;
 		TQueue< TWeakObjectPtr< UBlueprintNodeSpawner > > CurrentSpawners;
 
-		TUniquePtr< FDocumentationGenerator > DocGen;
+		FDocumentationGenerator* DocGen = nullptr;
+
+		/** Nodes whose docs are published but whose images are still to be drawn. */
+		TArray< FPendingNodeImage > PendingImages;
+
+		/** Document state, owned by the task and gone with it. */
+		FDocModel Document;
+		TSet< UClass* > ProcessedClasses;
+		/** Class to index in Document.Hierarchy, so every ancestor chain is only walked once */
+		TMap< const UClass*, int32 > HierarchyIndices;
+
+		/** Built with the first published docs, images coming in later don't change what it finds */
+		TSharedPtr< FDocSearchIndex > SearchIndex;
+
+		/** Lower-cased class doc id to index in Document.Classes, several classes can share an id. */
+		TMultiMap< FString, int32 > ClassIndexById;
 	};
 
 	struct FOutputTask
@@ -66,9 +93,19 @@ protected:
 	};
 
 protected:
+	/** Runs InTask as Current, which is reset once it is done however it ends. */
 	void ProcessTask(TSharedPtr< FGenTask > InTask);
-	static TArray<TSharedPtr<FJsonValue>> GetPropertyFlags(const FProperty* Property);
-	static TArray<TSharedPtr<FJsonValue>> GetFunctionFlags(const UFunction* Function);
+	void GenerateCurrentTask();
+	void GatherNativeClasses(TArray< FName > const& Modules);
+	void BuildNativeClassIndex(TArray< FName > const& Modules);
+	void AddClass(UClass* Class);
+	void InvalidateWarmState();
+	void WriteNodeData();
+	bool LaunchViewer();
+	bool RenderPendingNodeImages();
+	int32 GetHierarchyIndex(const UClass* Class, FDocModel& Model);
+	static FDocRange GetPropertyFlags(const FProperty* Property, FDocModel& Model);
+	static FDocRange GetFunctionFlags(const UFunction* Function, FDocModel& Model);
 
 	enum EIntermediateProcessingResult: uint8 {
 		Success,
@@ -83,9 +120,16 @@ protected:
 	TQueue< TSharedPtr< FGenTask > > Waiting;
 	TUniquePtr< FGenCurrentTask > Current;
 	TQueue< TSharedPtr< FOutputTask > > Converting;
-	TSet<UClass*> ProcessedClasses;
 	FThreadSafeBool bRunning;	// @NOTE: Using this to sync with module calls from game thread is not 100% okay (we're not atomically testing), but whatevs.
 	FThreadSafeBool bTerminationRequest;
+
+	/** Warm state kept between tasks, dropped when code is reloaded or modules change. */
+	TUniquePtr< FDocumentationGenerator > DocGen;
+	TArray< TWeakObjectPtr< UClass > > NativeClassIndex;
+	TArray< FName > IndexedModules;
+	FThreadSafeBool bWarmStateDirty;
+	FDelegateHandle ReloadCompleteHandle;
+	FDelegateHandle ModulesChangedHandle;
 	
 };
 
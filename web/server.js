@@ -1,6 +1,7 @@
 const express = require('express');
 const fs = require('fs').promises;
 const path = require('path');
+const http = require('http');
 const cors = require('cors');
 
 const app = express();
@@ -10,6 +11,8 @@ app.use(cors());
 app.use(express.json());
 
 const NOTES_FILE_PATH = path.join(__dirname, 'src', 'data', 'notes.json');
+const IMAGE_DIR = path.join(__dirname, 'public', 'img');
+const EDITOR_IMAGE_URL = `http://localhost:${process.env.CTRLDOC_IMAGE_PORT || 3027}/nodeimg`;
 
 app.get('/api/notes', async (req, res) => {
     try {
@@ -29,6 +32,30 @@ app.post('/api/notes', async (req, res) => {
     }
 });
 
+// Deferred node images: served from disk once drawn, otherwise forwarded to the editor that draws them
+app.get('/api/node-image', async (req, res) => {
+    const key = String(req.query.key || '');
+    const imagePath = path.resolve(IMAGE_DIR, key);
+    if (!imagePath.startsWith(IMAGE_DIR + path.sep)) {
+        return res.status(400).json({ error: 'Invalid image key' });
+    }
+
+    try {
+        await fs.access(imagePath);
+        return res.sendFile(imagePath);
+    } catch (error) {
+        // Not drawn yet
+    }
+
+    http.get(`${EDITOR_IMAGE_URL}?key=${encodeURIComponent(key)}`, (editorRes) => {
+        res.status(editorRes.statusCode);
+        res.set('Content-Type', editorRes.headers['content-type'] || 'image/png');
+        editorRes.pipe(res);
+    }).on('error', () => {
+        res.status(503).json({ error: 'The editor is not serving node images' });
+    });
+});
+
 app.listen(PORT, () => {
     console.log(`Server is running on http://localhost:${PORT}`);
 });
@@ -1,43 +1,142 @@
 // SearchResults.tsx
-import React from 'react';
-import { TreeItemConfig } from '../types/types';
-import { useNavigate } from 'react-router-dom';
-import { useSelectedClass } from '../providers/SelectedClassContextProvider';
+import React, {useEffect, useState} from 'react';
+import {useNavigate} from 'react-router-dom';
+import {TreeItemConfig} from '../types/types';
+import {useSelectedClass} from '../providers/SelectedClassContextProvider';
+import {dataService} from '../services/DataService';
+import {searchService} from '../services/SearchService';
+import {SidebarMenu, SidebarMenuButton, SidebarMenuItem} from './ui/sidebar';
 
 interface SearchResultsProps {
-    results: TreeItemConfig[];
+    query: string;
     activeItemId: string | null;
+    onClassClick: (item: TreeItemConfig) => void;
 }
 
-const SearchResults: React.FC<SearchResultsProps> = ({ results, activeItemId }) => {
+interface SearchHit {
+    key: string;
+    label: string;
+    // Kind and owner, or the description of a struct or enum, which have no page of their own
+    detail: string;
+    open?: () => void;
+    // Set on class hits, to mark the one shown
+    classId?: string;
+}
+
+const findByPath = (items: TreeItemConfig[], path: string): TreeItemConfig | null => {
+    for (const item of items) {
+        if (item.path === path) return item;
+        const found = item.children ? findByPath(item.children, path) : null;
+        if (found) return found;
+    }
+    return null;
+};
+
+// Class names containing the query, for data generated without a search index
+const filterItems = (items: TreeItemConfig[], query: string): TreeItemConfig[] => {
+    const results: TreeItemConfig[] = [];
+    items.forEach(item => {
+        if (item.name.toLowerCase().includes(query.toLowerCase())) {
+            results.push(item);
+        }
+        if (item.children) {
+            results.push(...filterItems(item.children, query));
+        }
+    });
+    return results;
+};
+
+const SearchResults: React.FC<SearchResultsProps> = ({query, activeItemId, onClassClick}) => {
     const navigate = useNavigate();
-    const { setSelectedClass } = useSelectedClass();
+    const {objectData, setSelectedClass, setSelectedFunction, setSelectedNode} = useSelectedClass();
+    const [hits, setHits] = useState<SearchHit[]>([]);
+
+    useEffect(() => {
+        let cancelled = false;
+
+        const classHit = (item: TreeItemConfig): SearchHit => ({
+            key: `class:${item.id}`,
+            label: item.name,
+            detail: 'Class',
+            open: () => onClassClick(item),
+            classId: item.id,
+        });
+
+        (async () => {
+            if (!(await searchService.isAvailable())) {
+                if (!cancelled) {
+                    setHits(filterItems(objectData, query).map(classHit));
+                }
+                return;
+            }
+
+            const [entries, classes] = await Promise.all([searchService.search(query), dataService.loadData()]);
+            if (cancelled) {
+                return;
+            }
+
+            const results: SearchHit[] = [];
+            entries.forEach((entry, index) => {
+                const key = `${entry.kind}:${entry.owner}:${entry.member}:${index}`;
+                if (entry.kind === 'struct' || entry.kind === 'enum') {
+                    const description = entry.kind === 'struct' ? dataService.getStruct(entry.owner)?.description : dataService.getEnum(entry.owner)?.description;
+                    results.push({key, label: entry.label, detail: description || (entry.kind === 'struct' ? 'Struct' : 'Enum')});
+                    return;
+                }
+
+                const item = classes[entry.owner] ? findByPath(objectData, classes[entry.owner].path) : null;
+                if (!item) {
+                    return;
+                }
+                if (entry.kind === 'class') {
+                    results.push(classHit(item));
+                } else if (entry.kind === 'property') {
+                    results.push({key, label: entry.label, detail: `Property of ${item.name}`, open: () => onClassClick(item)});
+                } else if (entry.kind === 'function') {
+                    const func = item.functions[entry.member];
+                    results.push({key, label: entry.label, detail: `Function of ${item.name}`, open: func && (() => {
+                        setSelectedClass(item);
+                        setSelectedFunction(func);
+                        navigate(`/class/${item.name}/function/${func.name}`);
+                    })});
+                } else if (entry.kind === 'node') {
+                    const node = item.nodes?.[entry.member];
+                    results.push({key, label: entry.label, detail: `Node of ${item.name}`, open: node && (() => {
+                        setSelectedClass(item);
+                        setSelectedNode(node);
+                        navigate(`/class/${item.name}/node/${node.fullTitle}`);
+                    })});
+                }
+            });
+            setHits(results);
+        })();
 
-    const handleItemClick = (item: TreeItemConfig) => {
-        navigate('class/' + item.path);
-        setSelectedClass(item);
-    };
+        return () => {
+            cancelled = true;
+        };
+    }, [query, objectData, onClassClick, navigate, setSelectedClass, setSelectedFunction, setSelectedNode]);
 
     return (
-        <ul>
-            {results.map((item) => (
-                <li key={item.id}>
-                    <button
-                        onClick={() => handleItemClick(item)}
-                        className={`
-                            flex flex-row justify-between pl-4 pr-1.5 py-1.5 text-sm w-full
-                                                            border-l-2 border-color-gray-200 hover:bg-gray-200 dark:border-gray-200/10 dark:hover:border-[#26bbff] hover:border-[#26bbff] dark:hover:text-white dark:hover:bg-[#202024] rounded-r
-                            ${activeItemId === item.id
-                            ? 'text-blue-500'
-                            : 'text-muted-foreground'
-                        }
-                        `}
+        <SidebarMenu>
+            {hits.map(hit => (
+                <SidebarMenuItem key={hit.key}>
+                    <SidebarMenuButton
+                        asChild
+                        className="h-auto"
+                        isActive={hit.classId !== undefined && activeItemId === hit.classId}
+                        onClick={(e) => {
+                            e.preventDefault();
+                            hit.open?.();
+                        }}
                     >
-                        {item.name}
-                    </button>
-                </li>
+                        <a href="#" className={`flex flex-col items-start gap-0 ${hit.open ? '' : 'cursor-default'}`}>
+                            <span className="font-medium">{hit.label}</span>
+                            <span className="text-xs text-muted-foreground line-clamp-2">{hit.detail}</span>
+                        </a>
+                    </SidebarMenuButton>
+                </SidebarMenuItem>
             ))}
-        </ul>
+        </SidebarMenu>
     );
 };
 
@@ -3,6 +3,7 @@ import { GalleryVerticalEnd, ChevronRight } from "lucide-react"
 import { useNavigate, useLocation } from 'react-router-dom'
 import { useSelectedClass } from '../providers/SelectedClassContextProvider'
 import { SearchForm } from "src/components/ui/search-form"
+import SearchResults from "src/components/SearchResults"
 import {
   Collapsible,
   CollapsibleContent,
@@ -53,25 +54,6 @@ export function AppSidebar({ ...props }: React.ComponentProps<typeof Sidebar>) {
     }
   }, [objectData, location.pathname]);
 
-  const filterItems = React.useCallback((items: any[], query: string): any[] => {
-    if (!query) return [];
-    const results: any[] = [];
-    items.forEach(item => {
-      if (item.name.toLowerCase().includes(query.toLowerCase())) {
-        results.push(item);
-      }
-      if (item.children) {
-        results.push(...filterItems(item.children, query));
-      }
-    });
-    return results;
-  }, []);
-
-  const searchResults = React.useMemo(() => 
-    filterItems(objectData, searchQuery), 
-    [objectData, searchQuery, filterItems]
-  );
-
   const handleItemClick = React.useCallback((item: any) => {
     setActiveItemId(item.id);
     setSelectedClass(item);
@@ -115,24 +97,11 @@ export function AppSidebar({ ...props }: React.ComponentProps<typeof Sidebar>) {
           {searchQuery ? (
             // Display search results
             <SidebarGroupContent>
-              <SidebarMenu>
-                {searchResults.map((item) => (
-                  <SidebarMenuItem key={item.id}>
-                    <SidebarMenuButton 
-                      asChild 
-                      onClick={(e) => {
-                        e.preventDefault();
-                        handleItemClick(item);
-                      }}
-                      isActive={activeItemId === item.id}
-                    >
-                      <a href="#" className="font-medium">
-                        {item.name}
-                      </a>
-                    </SidebarMenuButton>
-                  </SidebarMenuItem>
-                ))}
-              </SidebarMenu>
+              <SearchResults
+                query={searchQuery}
+                activeItemId={activeItemId}
+                onClassClick={handleItemClick}
+              />
             </SidebarGroupContent>
           ) : (
             // Display regular navigation with collapsible sections
@@ -2,9 +2,12 @@ import { useEffect, useState, useMemo } from 'react';
 import { useParams } from 'react-router-dom';
 import { useSelectedClass } from '../../providers/SelectedClassContextProvider';
 import { TreeItemConfig } from '../../types/types';
+import { dataService } from '../../services/DataService';
 import { FunctionList } from './FunctionList';
 import { NodeList } from './NodeList';
 import { PropertyList } from './PropertyList';
+import { UsageList } from './UsageList';
+import { typeService, TypeUsage } from '../../services/TypeService';
 import { Tabs, TabsContent, TabsList, TabsTrigger } from '../ui/tabs';
 import { ArrowRight, Dot } from 'lucide-react';
 
@@ -15,14 +18,39 @@ export const Class = () => {
 
     const { selectedClass, setSelectedClass, objectData } = useSelectedClass();
 
+    const [usages, setUsages] = useState<TypeUsage[]>([]);
+
+    useEffect(() => {
+        let cancelled = false;
+        setUsages([]);
+        if (selectedClass) {
+            typeService.getUsages(selectedClass.name).then(found => {
+                if (!cancelled) {
+                    setUsages(found);
+                }
+            });
+        }
+        return () => {
+            cancelled = true;
+        };
+    }, [selectedClass]);
+
+    const inherited = useMemo(() => selectedClass ? dataService.getInheritedMembers(selectedClass) : null, [selectedClass]);
+
     const tabs = useMemo(() => {
         if (!selectedClass) return [];
         return [
             { id: "properties", label: "Properties", count: selectedClass.properties?.length || 0 },
             { id: "functions", label: "Functions", count: selectedClass.functions?.length || 0 },
             { id: "nodes", label: "Nodes", count: selectedClass.nodes?.length || 0 },
+            { id: "inherited-properties", label: "Inherited Properties", count: inherited?.properties.length || 0 },
+            { id: "inherited-functions", label: "Inherited Functions", count: inherited?.functions.length || 0 },
+            { id: "inherited-nodes", label: "Inherited Nodes", count: inherited?.nodes.length || 0 },
+            { id: "usages", label: "Used By", count: usages.length },
         ].filter(tab => tab.count > 0);
-    }, [selectedClass]);
+    }, [selectedClass, inherited, usages]);
+
+    const ancestors = useMemo(() => selectedClass ? dataService.getAncestors(selectedClass) : [], [selectedClass]);
 
     const defaultTab = useMemo(() => tabs.length > 0 ? tabs[0].id : "properties", [tabs]);
 
@@ -78,10 +106,10 @@ export const Class = () => {
                 </p>
                 <div className="flex flex-col mt-2">
                     <div className="mt-1 flex items-center flex-wrap">
-                        {selectedClass?.classHierarchy?.map((item, index) => (
+                        {ancestors.map((item, index) => (
                             <div key={item} className="flex items-center text-muted-foreground">
                                 <span className="text-sm">{item}</span>
-                                {index < (selectedClass.classHierarchy?.length || 0) - 1 && (
+                                {index < ancestors.length - 1 && (
                                     <span className="mx-1 text-muted-foreground"><Dot className="size-4" /></span>
                                 )}
                             </div>
@@ -103,6 +131,10 @@ export const Class = () => {
                             {tab.id === "properties" && <PropertyList properties={selectedClass?.properties} />}
                             {tab.id === "functions" && <FunctionList functions={selectedClass?.functions} />}
                             {tab.id === "nodes" && <NodeList nodes={selectedClass?.nodes || []} />}
+                            {tab.id === "inherited-properties" && <PropertyList properties={inherited?.properties} />}
+                            {tab.id === "inherited-functions" && <FunctionList functions={inherited?.functions} />}
+                            {tab.id === "inherited-nodes" && <NodeList nodes={inherited?.nodes || []} />}
+                            {tab.id === "usages" && <UsageList usages={usages} />}
                         </TabsContent>
                     ))}
                 </Tabs>
@@ -4,7 +4,6 @@ import { Separator } from '../ui/separator';
 import { Input } from '../ui/input';
 import {Button} from '../ui/button';
 import {DropdownMenu, DropdownMenuTrigger, DropdownMenuContent, DropdownMenuCheckboxItem } from '../ui/dropdown-menu';
-import nodes from '../../data/nodes.json';
 import { useNavigate } from 'react-router-dom';
 import { useSelectedClass } from '../../providers/SelectedClassContextProvider';
 import {Alert, AlertDescription, AlertTitle} from '../ui/alert';
@@ -269,7 +268,3 @@ export const FunctionList: FC<FunctionListProps> = ({ functions }) => {
 type FunctionListProps = {
     functions: FunctionConfig[]
 };
-
-// Usage example
-const functions = nodes.nodes.flatMap(node => node.functions); // Flatten functions from nodes
-<FunctionList functions={functions} />
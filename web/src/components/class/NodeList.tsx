@@ -6,6 +6,7 @@ import {Alert, AlertDescription, AlertTitle} from '../ui/alert';
 import {ExclamationTriangleIcon} from '@radix-ui/react-icons';
 import {PinInput} from "../node/PinInput";
 import {PinOutput} from "../node/PinOutput";
+import {NodeImage} from "../node/NodeImage";
 import {NodePins} from "../NodePins";
 import {useNotes} from "../../providers/NotesContextProvider";
 import {NoteDialog} from "../../components/NoteDialog";
@@ -156,11 +157,7 @@ export const NodeList: FC<NodeListProps> = ({ nodes }) => {
                                     <TableCell className="align-top">
                                         <div className="flex flex-col">
                                             <div className="rounded-lg max-w-[275px]">
-                                                <img 
-                                                    src={node.imgPath?.replace('..', '')}
-                                                    alt={`Visualization of node: ${node.description}`}
-                                                    className="w-full rounded-lg"
-                                                />
+                                                <NodeImage node={node} className="w-full rounded-lg" thumbnail/>
                                             </div>
                                             {/* <h3 className="text-lg font-bold">
                                                 {node.fullTitle}
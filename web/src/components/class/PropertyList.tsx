@@ -3,7 +3,6 @@ import {FunctionConfig, PropertyConfig} from '../../types/types';
 import { Popover, PopoverContent, PopoverTrigger } from '../ui/popover';
 import { Separator } from '../ui/separator';
 import { Input } from '../ui/input';
-import nodes from '../../data/nodes.json';
 import {
     DropdownMenu,
     DropdownMenuCheckboxItem,
@@ -242,7 +241,3 @@ export const PropertyList: FC<PropertyListProps> = ({ properties }) => {
 type PropertyListProps = {
     properties: PropertyConfig[]
 };
-
-// Usage example
-const properties = nodes.nodes.flatMap(node => node.properties); // Flatten properties from nodes
-<PropertyList properties={properties}/>
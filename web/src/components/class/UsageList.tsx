@@ -0,0 +1,106 @@
+import {FC, useEffect, useState} from 'react';
+import {Link} from 'react-router-dom';
+import {TypeUsage} from '../../services/TypeService';
+import {dataService} from '../../services/DataService';
+import {ClassConfig} from '../../types/types';
+import {Alert, AlertDescription, AlertTitle} from '../ui/alert';
+import {ExclamationTriangleIcon} from '@radix-ui/react-icons';
+import {
+    Table,
+    TableBody,
+    TableCell,
+    TableHead,
+    TableHeader,
+    TableRow
+} from '../ui/table';
+
+interface UsageListProps {
+    usages: TypeUsage[];
+}
+
+interface UsageRow {
+    role: string;
+    owner: string;
+    // Set when the owner is a class with a page of its own
+    ownerPath?: string;
+    member: string;
+}
+
+const describeUsage = (classes: ClassConfig, usage: TypeUsage): UsageRow | null => {
+    if (usage.role === 'structMember') {
+        const struct = dataService.getStruct(usage.owner);
+        return struct ? {role: 'Struct member', owner: struct.structName, member: struct.properties[usage.member]?.name ?? ''} : null;
+    }
+
+    const owner = classes[usage.owner];
+    if (!owner) {
+        return null;
+    }
+    if (usage.role === 'property') {
+        return {role: 'Property', owner: owner.className, ownerPath: owner.path, member: owner.properties[usage.member]?.name ?? ''};
+    }
+    const func = owner.functions[usage.member];
+    const member = usage.role === 'parameter' ? `${func?.name}(${func?.parameters?.[usage.parameter]?.name ?? ''})` : func?.name ?? '';
+    return {role: usage.role === 'parameter' ? 'Parameter' : 'Return value', owner: owner.className, ownerPath: owner.path, member};
+};
+
+export const UsageList: FC<UsageListProps> = ({usages}) => {
+    const [rows, setRows] = useState<UsageRow[]>([]);
+
+    useEffect(() => {
+        let cancelled = false;
+        dataService.loadData().then(classes => {
+            if (!cancelled) {
+                setRows(usages.map(usage => describeUsage(classes, usage)).filter((row): row is UsageRow => row !== null));
+            }
+        });
+        return () => {
+            cancelled = true;
+        };
+    }, [usages]);
+
+    if (rows.length === 0) {
+        return (
+            <Alert className="max-w-[400px]">
+                <ExclamationTriangleIcon className="h-6 w-6"/>
+                <AlertTitle>Heads up!</AlertTitle>
+                <AlertDescription>
+                    Nothing documented uses this class.
+                </AlertDescription>
+            </Alert>
+        );
+    }
+
+    return (
+        <div className="w-full">
+            <Table className="w-full max-w-[1100px]">
+                <TableHeader>
+                    <TableRow>
+                        <TableHead className="w-[40%]">Used by</TableHead>
+                        <TableHead className="w-[40%]">Member</TableHead>
+                        <TableHead className="w-[20%]">As</TableHead>
+                    </TableRow>
+                </TableHeader>
+                <TableBody>
+                    {rows.map((row, index) => (
+                        <TableRow key={index} className="h-[49px]">
+                            <TableCell>
+                                {row.ownerPath ? (
+                                    <Link to={`/class/${row.ownerPath}`} className="font-medium hover:underline">{row.owner}</Link>
+                                ) : (
+                                    <span className="font-medium">{row.owner}</span>
+                                )}
+                            </TableCell>
+                            <TableCell>
+                                <div className="font-mono">{row.member}</div>
+                            </TableCell>
+                            <TableCell>
+                                <div className="text-muted-foreground">{row.role}</div>
+                            </TableCell>
+                        </TableRow>
+                    ))}
+                </TableBody>
+            </Table>
+        </div>
+    );
+};
@@ -15,7 +15,7 @@ export const Function = () => {
         return <div>Loading...</div>;
     }
 
-    const {description, name, flags, parameters, returnType} = selectedFunction || {}; // Provide a fallback to prevent errors if selectedFunction is undefined
+    const {description, name, flags, parameters, returnType, returnDescription} = selectedFunction || {}; // Provide a fallback to prevent errors if selectedFunction is undefined
 
     if (!selectedFunction) {
         return <p>No function selected</p>;  // Conditional rendering in case there's no selected function
@@ -34,6 +34,9 @@ export const Function = () => {
                     <Card>
                         <CardContent>
                             <div className="text-lg font-bold text-informational mt-4">{returnType}</div>
+                            {returnDescription && (
+                                <p className="text-sm text-muted-foreground mt-1">{returnDescription}</p>
+                            )}
                             {flags && flags.length > 0 && (
                                 <>
                                     <Separator className="my-2"/>
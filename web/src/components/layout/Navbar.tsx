@@ -1,4 +1,5 @@
 import {ThemeSwitcher} from 'src/components/ui/ThemeSwitcher';
+import {LanguageSwitcher} from 'src/components/ui/LanguageSwitcher';
 import {GitHubLogoIcon} from "@radix-ui/react-icons";
 
 const Navbar = () => {
@@ -10,6 +11,7 @@ const Navbar = () => {
                 <a href="https://github.com/ntystudio/CTRL-documentable" target="_blank" className="text-xl text-foreground">
                     <GitHubLogoIcon className="w-6 h-6 mr-2 text-black dark:text-white"/>
                 </a>
+                <LanguageSwitcher />
                 <ThemeSwitcher />
             </div>
         </nav>
@@ -6,6 +6,7 @@ import NodeBreadcrumbs from '../ui/NodeBreadcrumbs';
 import {Separator} from '../ui/separator';
 import {NodePins} from "../NodePins";
 import {NoteSection} from "../../components/NoteSection";
+import {NodeImage} from './NodeImage';
 
 
 export const Node = () => {
@@ -15,7 +16,7 @@ export const Node = () => {
         return <div>Loading...</div>;
     }
 
-    const {shortTitle, description, imgPath, inputs, outputs} = selectedNode;
+    const {shortTitle, description, inputs, outputs, unavailableIn} = selectedNode;
 
     return (
         <main className="p-2">
@@ -28,8 +29,7 @@ export const Node = () => {
             <div className="grid grid-cols-12 gap-8 w-full max-w-[1200px]">
                 <div className="col-span-4 flex flex-col">
                     <div className="rounded-lg p-2 bg-muted border-2 mb-3">
-                        <img className="w-full max-w-[300px] mx-auto rounded-lg" src={imgPath?.replace('..', '')}
-                             alt={`Visualization of node: ${description}`}/>
+                        <NodeImage className="w-full max-w-[300px] mx-auto rounded-lg" node={selectedNode}/>
                     </div>
                 </div>
                 <div className="col-span-8">
@@ -41,6 +41,10 @@ export const Node = () => {
                         <p className="text-muted-foreground text-lg mb-4">{description}</p>
                     )}
 
+                    {unavailableIn && unavailableIn.length > 0 && (
+                        <p className="text-sm text-muted-foreground mb-4">Not available in {unavailableIn.join(', ')} blueprints</p>
+                    )}
+
                     <NoteSection
                         classId={selectedClass.name}
                         itemId={selectedNode.fullTitle}
@@ -0,0 +1,70 @@
+import {FC, useState} from 'react';
+import {NodeConfig} from '../../types/types';
+import {Skeleton} from '../ui/skeleton';
+
+interface NodeImageProps {
+    node: NodeConfig;
+    className?: string;
+    // Prefer the downscaled copy when the generator wrote one
+    thumbnail?: boolean;
+}
+
+// Drawn by the editor on first request, through the local server
+const deferredImageUrl = (imgPath: string) =>
+    `http://localhost:3026/api/node-image?key=${encodeURIComponent(imgPath.replace('../img/', ''))}`;
+
+// Percent-based background offset so the sprite scales with its container
+const spriteOffset = (pos: number, size: number, sheetSize: number) =>
+    sheetSize > size ? `${(pos / (sheetSize - size)) * 100}%` : '0%';
+
+export const NodeImage: FC<NodeImageProps> = ({node, className, thumbnail}) => {
+    const {imgPath, imgDeferred, imgPending, thumbPath, sprite, width, height, placeholder, description} = node;
+    const [loaded, setLoaded] = useState(false);
+
+    // Sprite rects are in sheet pixels, so sprites always come from the full-size sheet
+    const src = imgDeferred
+        ? deferredImageUrl(imgPath)
+        : (thumbnail && thumbPath && !sprite ? thumbPath : imgPath)?.replace('..', '');
+    const alt = `Visualization of node: ${description}`;
+
+    // Still being drawn by the second generation pass, the data is republished once it lands
+    if (imgPending) {
+        return <Skeleton className={`${className ?? ''} h-24`} aria-label={alt}/>;
+    }
+
+    if (!sprite) {
+        return (
+            <img
+                className={className}
+                src={src}
+                alt={alt}
+                width={width}
+                height={height}
+                loading="lazy"
+                decoding="async"
+                onLoad={() => setLoaded(true)}
+                style={{
+                    height: 'auto',
+                    backgroundImage: placeholder && !loaded ? `url("${placeholder}")` : undefined,
+                    backgroundSize: '100% 100%',
+                }}
+            />
+        );
+    }
+
+    const {x, y, w, h, sheetWidth, sheetHeight} = sprite;
+    return (
+        <div
+            role="img"
+            aria-label={alt}
+            className={className}
+            style={{
+                aspectRatio: `${w} / ${h}`,
+                backgroundImage: `url("${src}")`,
+                backgroundRepeat: 'no-repeat',
+                backgroundSize: `${(sheetWidth / w) * 100}% ${(sheetHeight / h) * 100}%`,
+                backgroundPosition: `${spriteOffset(x, w, sheetWidth)} ${spriteOffset(y, h, sheetHeight)}`,
+            }}
+        />
+    );
+};
@@ -5,11 +5,12 @@ interface NodePinInputProps {
     item: NodePinConfig;
 }
 
-export const PinInput: FC<NodePinInputProps> = ({item: {name, type}}) => {
+export const PinInput: FC<NodePinInputProps> = ({item: {name, type, contexts}}) => {
     return (
         <>
             <span className="font-medium font-mono text-informational mr-2">{type}</span> 
             <span className="font-medium">{name}</span>
+            {contexts && <span className="text-xs text-muted-foreground ml-2">only in {contexts.join(', ')}</span>}
         </>
     );
 };
@@ -4,11 +4,12 @@ import {NodePinConfig} from '../../types/types';
 type NodePinOutputProps = {
     item: NodePinConfig;
 };
-export const PinOutput: FC<NodePinOutputProps> = ({item: {name, type, description}}) => {
+export const PinOutput: FC<NodePinOutputProps> = ({item: {name, type, description, contexts}}) => {
     return (
         <>
             <span className="font-medium font-mono text-informational mr-2">{type}</span>
             <span className="font-medium">{name}</span>
+            {contexts && <span className="text-xs text-muted-foreground ml-2">only in {contexts.join(', ')}</span>}
         </>
     );
 };
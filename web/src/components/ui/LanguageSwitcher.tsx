@@ -0,0 +1,35 @@
+import {useEffect, useState} from 'react';
+import {localeService} from 'src/services/LocaleService';
+
+// Only shown when the docs were published in more than one culture
+export const LanguageSwitcher = () => {
+    const [cultures, setCultures] = useState<string[]>([]);
+    const [culture, setCulture] = useState<string>('');
+
+    useEffect(() => {
+        localeService.loadIndex().then(index => {
+            if (index && index.cultures.length > 0) {
+                setCultures([index.source, ...index.cultures]);
+            }
+        });
+        localeService.getCulture().then(current => setCulture(current ?? ''));
+    }, []);
+
+    if (cultures.length === 0) {
+        return null;
+    }
+
+    return (
+        <select
+            value={culture}
+            onChange={event => localeService.setCulture(event.target.value)}
+            className="mx-2 rounded border bg-background px-2 py-1 text-sm text-foreground"
+        >
+            {cultures.map(name => (
+                <option key={name} value={name}>{name}</option>
+            ))}
+        </select>
+    );
+};
+
+export default LanguageSwitcher;
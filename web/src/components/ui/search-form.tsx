@@ -41,7 +41,7 @@ export function SearchForm({
           </Label>
           <SidebarInput
             id="search"
-            placeholder="Search classes..."
+            placeholder="Search classes, members and types..."
             className="pl-8"
             value={searchQuery}
             onChange={handleChange}
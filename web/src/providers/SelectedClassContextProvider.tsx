@@ -1,6 +1,6 @@
 import React, {createContext, useContext, useState, useEffect, Dispatch, SetStateAction, FC, ReactNode} from 'react';
 import {FunctionConfig, NodeConfig, TreeItemConfig} from '../types/types';
-import {generateTreeData} from '../utils/TreeDataUtil';
+import {generateTreeData, loadNavigationTree} from '../utils/TreeDataUtil';
 
 /*
   This context provider is used to store the selected node, class, and function data.
@@ -90,9 +90,19 @@ export const SelectedClassContextProvider: FC<{children: ReactNode}> = ({childre
     }, [selectedNode, selectedFunction, classState, objectData]);
 
     useEffect(() => {
+        let loaded = false;
+
+        // The small navigation file lets the sidebar show before the full data is processed
+        loadNavigationTree().then(navigation => {
+            if (navigation && !loaded) {
+                setObjectData(navigation);
+            }
+        });
+
         const fetchData = async () => {
             try {
                 const treeData = await generateTreeData();
+                loaded = true;
                 setObjectData(treeData);
                 console.log(treeData);
             } catch (error) {
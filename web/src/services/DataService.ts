@@ -1,12 +1,97 @@
 // DataService.ts
-import {ClassConfig} from '../types/types';
-import jsonData from '../data/nodes.json';
+import {ClassConfig, ClassHierarchyConfig, EnumConfig, FunctionConfig, InheritedConfig, NodeConfig, ObjectConfig, PropertyConfig, StructConfig} from '../types/types';
+import {localeService} from './LocaleService';
+
+interface NodesFile {
+    nodes: ObjectConfig[];
+    hierarchy?: ClassHierarchyConfig;
+    structs?: StructConfig[];
+    enums?: EnumConfig[];
+}
+
+// Look up [classIndex, memberIndex] pairs in the members of the owning classes
+const resolveRefs = <T>(classes: ClassConfig, refs: number[] | undefined, members: (item: ObjectConfig) => T[] | undefined): T[] => {
+    const result: T[] = [];
+    for (let i = 0; refs && i + 1 < refs.length; i += 2) {
+        const member = members(classes[refs[i]])?.[refs[i + 1]];
+        if (member) {
+            result.push(member);
+        }
+    }
+    return result;
+};
+
+export interface InheritedMembers {
+    properties: PropertyConfig[];
+    functions: FunctionConfig[];
+    nodes: NodeConfig[];
+}
 
 class DataService {
-    private dataCache: ClassConfig = jsonData.nodes;
+    // Empty until loadData resolves
+    private dataCache: ClassConfig = [];
+    private hierarchy?: ClassHierarchyConfig;
+    private structs: StructConfig[] = [];
+    private enums: EnumConfig[] = [];
+    private localized: Promise<ClassConfig> | null = null;
+
+    // Served beside the app rather than bundled, so the sidebar can show from navigation/index.json while this loads
+    private fetchNodes(): Promise<NodesFile> {
+        return fetch(`${process.env.PUBLIC_URL}/nodes.json`).then(response => {
+            if (!response.ok) {
+                throw new Error(`Failed to load nodes.json: ${response.status}`);
+            }
+            return response.json() as Promise<NodesFile>;
+        });
+    }
 
+    // In the reader's culture when the generator published a table for it
     async loadData(): Promise<ClassConfig> {
-        return this.dataCache;
+        if (!this.localized) {
+            this.localized = this.fetchNodes()
+                .then(file => {
+                    this.hierarchy = file.hierarchy;
+                    this.structs = file.structs ?? [];
+                    this.enums = file.enums ?? [];
+                    return localeService.localize(file.nodes);
+                })
+                .then(data => (this.dataCache = data));
+            // A failed load may be retried
+            this.localized.catch(() => (this.localized = null));
+        }
+        return this.localized;
+    }
+
+    // Everything a class gets from its documented ancestors, nearest declaration first
+    getInheritedMembers(item: {inherited?: InheritedConfig}): InheritedMembers {
+        const classes = this.dataCache;
+        return {
+            properties: resolveRefs(classes, item.inherited?.properties, owner => owner.properties),
+            functions: resolveRefs(classes, item.inherited?.functions, owner => owner.functions),
+            nodes: resolveRefs(classes, item.inherited?.nodes, owner => owner.nodes),
+        };
+    }
+
+    getStruct(index: number): StructConfig | undefined {
+        return this.structs[index];
+    }
+
+    getEnum(index: number): EnumConfig | undefined {
+        return this.enums[index];
+    }
+
+    // Ancestors of a class, root first, walked up the shared hierarchy table
+    getAncestors(item: {hierarchyIndex?: number; classHierarchy?: string[]}): string[] {
+        const hierarchy = this.hierarchy;
+        if (!hierarchy || item.hierarchyIndex === undefined) {
+            // Data written before the table still lists them per class
+            return item.classHierarchy ?? [];
+        }
+        const ancestors: string[] = [];
+        for (let index = hierarchy.parents[item.hierarchyIndex] ?? -1; index !== -1; index = hierarchy.parents[index]) {
+            ancestors.push(hierarchy.names[index]);
+        }
+        return ancestors.reverse();
     }
 }
 
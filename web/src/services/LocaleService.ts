@@ -0,0 +1,107 @@
+// LocaleService.ts
+// Translates the docs with the string tables the generator writes to public/locales, one per additional culture.
+
+interface LocaleIndexFile {
+    // Culture the docs were generated in
+    source: string;
+    cultures: string[];
+}
+
+interface LocaleFile {
+    culture: string;
+    strings: Record<string, string>;
+}
+
+const storageKey = 'docsCulture';
+
+const fetchJson = <T>(path: string): Promise<T | null> =>
+    fetch(`${process.env.PUBLIC_URL}/locales/${path}`)
+        .then(response => (response.ok ? (response.json() as Promise<T>) : null))
+        .catch(() => null);
+
+// Fields holding localized texts; names, paths and ids are left alone so links keep working
+const textFields = new Set(['description', 'returnDescription', 'shortTitle', 'fullTitle', 'displayName']);
+// Pin names and types are localized texts too
+const pinFields = new Set(['name', 'type']);
+
+const translate = <T>(value: T, strings: Record<string, string>, fields: Set<string> = textFields): T => {
+    if (Array.isArray(value)) {
+        return value.map(item => translate(item, strings, fields)) as unknown as T;
+    }
+    if (!value || typeof value !== 'object') {
+        return value;
+    }
+
+    const result: Record<string, unknown> = {};
+    Object.entries(value as Record<string, unknown>).forEach(([key, item]) => {
+        if (typeof item === 'string') {
+            result[key] = textFields.has(key) || fields.has(key) ? strings[item] ?? item : item;
+        } else {
+            result[key] = translate(item, strings, key === 'inputs' || key === 'outputs' ? pinFields : textFields);
+        }
+    });
+    return result as T;
+};
+
+class LocaleService {
+    private index: Promise<LocaleIndexFile | null> | null = null;
+    private tables = new Map<string, Promise<LocaleFile | null>>();
+
+    loadIndex(): Promise<LocaleIndexFile | null> {
+        if (!this.index) {
+            this.index = fetchJson<LocaleIndexFile>('index.json');
+        }
+        return this.index;
+    }
+
+    // ?lang= first, then the last pick, then the browser's languages; the generated culture if none of them is available
+    async getCulture(): Promise<string | null> {
+        const index = await this.loadIndex();
+        if (!index) {
+            return null;
+        }
+        const wanted = [
+            new URLSearchParams(window.location.search).get('lang'),
+            localStorage.getItem(storageKey),
+            ...navigator.languages,
+        ].filter((culture): culture is string => !!culture);
+
+        for (const culture of wanted) {
+            if (culture === index.source) {
+                return index.source;
+            }
+            const match = index.cultures.find(available => available === culture)
+                ?? index.cultures.find(available => available === culture.split('-')[0]);
+            if (match) {
+                return match;
+            }
+        }
+        return index.source;
+    }
+
+    // Switching reloads, the data and everything built from it is translated once as it loads
+    setCulture(culture: string) {
+        localStorage.setItem(storageKey, culture);
+        const url = new URL(window.location.href);
+        url.searchParams.delete('lang');
+        window.location.assign(url.toString());
+    }
+
+    async localize<T>(data: T): Promise<T> {
+        const index = await this.loadIndex();
+        const culture = await this.getCulture();
+        if (!index || !culture || culture === index.source) {
+            return data;
+        }
+
+        let table = this.tables.get(culture);
+        if (!table) {
+            table = fetchJson<LocaleFile>(`${culture}.json`);
+            this.tables.set(culture, table);
+        }
+        const strings = (await table)?.strings;
+        return strings ? translate(data, strings) : data;
+    }
+}
+
+export const localeService = new LocaleService();
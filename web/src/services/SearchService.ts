@@ -0,0 +1,150 @@
+// SearchService.ts
+// Queries the index the generator writes to public/search, fetching each shard the first time a query needs it.
+
+export interface SearchEntry {
+    kind: string;
+    // Index of the class, struct or enum in the data
+    owner: number;
+    // Index in the owner's properties, functions or nodes; -1 for the owner itself
+    member: number;
+    label: string;
+}
+
+interface IndexFile {
+    kinds: string[];
+    shards: string[];
+    entryCount: number;
+    entriesPerShard: number;
+}
+
+// [kind, owner, member, label] per entry
+type EntriesFile = [number, number, number, string][];
+
+interface ShardFile {
+    tokens: string[];
+    postings: number[][];
+}
+
+// Same split the generator uses for descriptions
+const tokenize = (query: string): string[] =>
+    query.toLowerCase().split(/[^\p{L}\p{N}_]+/u).filter(word => word.length > 0);
+
+const shardKey = (word: string): string => /^[a-z0-9]/.test(word) ? word[0] : '_';
+
+// Index of the first token not less than prefix
+const lowerBound = (tokens: string[], prefix: string): number => {
+    let low = 0;
+    let high = tokens.length;
+    while (low < high) {
+        const mid = (low + high) >> 1;
+        if (tokens[mid] < prefix) {
+            low = mid + 1;
+        } else {
+            high = mid;
+        }
+    }
+    return low;
+};
+
+const EXACT_MATCH_BONUS = 4;
+
+class SearchService {
+    private index: Promise<IndexFile | null> | null = null;
+    private shards = new Map<string, Promise<ShardFile | null>>();
+    private entryShards = new Map<number, Promise<EntriesFile | null>>();
+
+    private fetchJson<T>(path: string): Promise<T | null> {
+        return fetch(`${process.env.PUBLIC_URL}/search/${path}`)
+            .then(response => (response.ok ? (response.json() as Promise<T>) : null))
+            .catch(() => null);
+    }
+
+    private loadIndex(): Promise<IndexFile | null> {
+        if (!this.index) {
+            this.index = this.fetchJson<IndexFile>('index.json');
+        }
+        return this.index;
+    }
+
+    private loadEntryShard(shardIndex: number): Promise<EntriesFile | null> {
+        let shard = this.entryShards.get(shardIndex);
+        if (!shard) {
+            shard = this.fetchJson<EntriesFile>(`entries/${shardIndex}.json`);
+            this.entryShards.set(shardIndex, shard);
+        }
+        return shard;
+    }
+
+    private loadShard(key: string): Promise<ShardFile | null> {
+        let shard = this.shards.get(key);
+        if (!shard) {
+            shard = this.fetchJson<ShardFile>(`${key}.json`);
+            this.shards.set(key, shard);
+        }
+        return shard;
+    }
+
+    // Whether the generator wrote an index to query
+    async isAvailable(): Promise<boolean> {
+        return (await this.loadIndex()) !== null;
+    }
+
+    // Entries matching every word of the query, each as a token or a prefix of one, best first
+    async search(query: string, maxResults = 50): Promise<SearchEntry[]> {
+        const index = await this.loadIndex();
+        // Single characters are only a prefix while they are all there is
+        const allWords = tokenize(query);
+        const words = allWords.length > 1 ? allWords.filter(word => word.length > 1) : allWords;
+        if (!index || words.length === 0) {
+            return [];
+        }
+
+        let scores: Map<number, number> | null = null;
+        for (const word of words) {
+            const shard = index.shards.includes(shardKey(word)) ? await this.loadShard(shardKey(word)) : null;
+            const wordScores = new Map<number, number>();
+            for (let i = shard ? lowerBound(shard.tokens, word) : 0; shard && i < shard.tokens.length && shard.tokens[i].startsWith(word); i++) {
+                const bonus = shard.tokens[i].length === word.length ? EXACT_MATCH_BONUS : 0;
+                const postings = shard.postings[i];
+                for (let p = 0; p + 1 < postings.length; p += 2) {
+                    const entry = postings[p];
+                    if (scores && !scores.has(entry)) {
+                        continue;
+                    }
+                    wordScores.set(entry, Math.max(wordScores.get(entry) ?? 0, postings[p + 1] + bonus));
+                }
+            }
+
+            if (!scores) {
+                scores = wordScores;
+                continue;
+            }
+            const previous: Map<number, number> = scores;
+            const combined = new Map<number, number>();
+            wordScores.forEach((score, entry) => combined.set(entry, score + (previous.get(entry) ?? 0)));
+            scores = combined;
+        }
+
+        const best = Array.from(scores ?? new Map<number, number>())
+            .sort((a, b) => b[1] - a[1])
+            .slice(0, maxResults)
+            .map(([entry]) => entry);
+
+        // Only the runs of entries the results fall in
+        const shardIndices = Array.from(new Set(best.map(entry => Math.floor(entry / index.entriesPerShard))));
+        const entryShards = new Map<number, EntriesFile | null>();
+        await Promise.all(shardIndices.map(async shardIndex => entryShards.set(shardIndex, await this.loadEntryShard(shardIndex))));
+
+        const results: SearchEntry[] = [];
+        for (const entry of best) {
+            const found = entryShards.get(Math.floor(entry / index.entriesPerShard))?.[entry % index.entriesPerShard];
+            if (found) {
+                const [kind, owner, member, label] = found;
+                results.push({kind: index.kinds[kind], owner, member, label});
+            }
+        }
+        return results;
+    }
+}
+
+export const searchService = new SearchService();
@@ -0,0 +1,78 @@
+// TypeService.ts
+// Looks up where a type is used in the index the generator writes to public/types.
+
+export interface TypeUsage {
+    role: string;
+    // Index of the class, or of the struct for struct members
+    owner: number;
+    // Index in the owner's properties or functions
+    member: number;
+    // Index in the function's parameters; -1 unless the role is parameter
+    parameter: number;
+}
+
+interface TypeIndexFile {
+    roles: string[];
+    shardCount: number;
+    types: string[];
+    counts: number[];
+}
+
+type TypeShardFile = Record<string, number[]>;
+
+// FNV-1a over UTF-16 code units, as the generator hashes type names
+const hashTypeName = (name: string): number => {
+    let hash = 2166136261;
+    for (let i = 0; i < name.length; i++) {
+        hash ^= name.charCodeAt(i);
+        hash = Math.imul(hash, 16777619) >>> 0;
+    }
+    return hash;
+};
+
+class TypeService {
+    private index: Promise<TypeIndexFile | null> | null = null;
+    private shards = new Map<number, Promise<TypeShardFile | null>>();
+
+    private fetchJson<T>(path: string): Promise<T | null> {
+        return fetch(`${process.env.PUBLIC_URL}/types/${path}`)
+            .then(response => (response.ok ? (response.json() as Promise<T>) : null))
+            .catch(() => null);
+    }
+
+    private loadIndex(): Promise<TypeIndexFile | null> {
+        if (!this.index) {
+            this.index = this.fetchJson<TypeIndexFile>('index.json');
+        }
+        return this.index;
+    }
+
+    // Every type used anywhere, with how often
+    async listTypes(): Promise<{name: string; count: number}[]> {
+        const index = await this.loadIndex();
+        return index ? index.types.map((name, i) => ({name, count: index.counts[i]})) : [];
+    }
+
+    async getUsages(typeName: string): Promise<TypeUsage[]> {
+        const index = await this.loadIndex();
+        if (!index) {
+            return [];
+        }
+
+        const shardIndex = hashTypeName(typeName) & (index.shardCount - 1);
+        let shard = this.shards.get(shardIndex);
+        if (!shard) {
+            shard = this.fetchJson<TypeShardFile>(`${shardIndex}.json`);
+            this.shards.set(shardIndex, shard);
+        }
+
+        const runs = (await shard)?.[typeName] ?? [];
+        const usages: TypeUsage[] = [];
+        for (let i = 0; i + 3 < runs.length; i += 4) {
+            usages.push({role: index.roles[runs[i]], owner: runs[i + 1], member: runs[i + 2], parameter: runs[i + 3]});
+        }
+        return usages;
+    }
+}
+
+export const typeService = new TypeService();
@@ -9,15 +9,35 @@ export interface NodeConfig {
     shortTitle: string;
     fullTitle: string;
     imgPath: string;
+    imgDeferred?: boolean;
+    imgPending?: boolean;
+    width?: number;
+    height?: number;
+    placeholder?: string;
+    thumbPath?: string;
+    sprite?: NodeSpriteConfig;
     inputs: NodePinConfig[];
     outputs: NodePinConfig[];
     description?: string;
+    // Blueprint contexts the node can't be placed in
+    unavailableIn?: string[];
+}
+
+// Where a node image sits on its class sprite sheet, in sheet pixels
+export interface NodeSpriteConfig {
+    x: number;
+    y: number;
+    w: number;
+    h: number;
+    sheetWidth: number;
+    sheetHeight: number;
 }
 
 // FunctionList
 export interface FunctionConfig {
     name: string;
     returnType: string;
+    returnDescription?: string;
     parameters: ParameterConfig[];
     flags?: string[];
     description?: string;
@@ -36,6 +56,8 @@ export interface NodePinConfig {
     name: string;
     type: string;
     description?: string;
+    // Set when the pin only shows in some blueprint contexts
+    contexts?: string[];
 }
 
 // Parameters used in FunctionList
@@ -55,7 +77,10 @@ export interface TreeItemConfig {
     properties: Array<PropertyConfig>;
     functions: Array<FunctionConfig>;
     nodes?: Array<NodeConfig>;
+    // Index into ClassHierarchyConfig, see DataService.getAncestors
+    hierarchyIndex?: number;
     classHierarchy?: string[];
+    inherited?: InheritedConfig;
 }
 
 export type ITreeData = Array<TreeItemConfig>;
@@ -63,11 +88,71 @@ export type ITreeData = Array<TreeItemConfig>;
 // Main Class Interface
 export interface ObjectConfig {
     className: string;
-    classHierarchy: string[];
+    // Index into ClassHierarchyConfig
+    hierarchyIndex: number;
+    // Ancestors, root first; only in data written before the hierarchy table
+    classHierarchy?: string[];
+    inherited?: InheritedConfig;
     path: IPath;
     properties: Array<PropertyConfig>;
     functions: Array<FunctionConfig>;
     nodes?: Array<NodeConfig>;
 }
 
+// Members of ancestor classes as flat [classIndex, memberIndex, ...] pairs into the class list
+export interface InheritedConfig {
+    properties: number[];
+    functions: number[];
+    nodes: number[];
+}
+
 export type ClassConfig = ObjectConfig[];
+
+// Inheritance table shared by all classes, one column per field; -1 means none
+export interface ClassHierarchyConfig {
+    names: string[];
+    parents: number[];
+    depths: number[];
+    // Index into the class list when the class is documented
+    docIndices: number[];
+    children: number[][];
+}
+
+// Structs and enums, listed beside the classes in nodes.json
+export interface StructConfig {
+    structName: string;
+    path: IPath;
+    superStruct?: string;
+    description?: string;
+    properties: Array<PropertyConfig>;
+}
+
+export interface EnumValueConfig {
+    name: string;
+    displayName: string;
+    value: number;
+    description?: string;
+}
+
+export interface EnumConfig {
+    enumName: string;
+    path: IPath;
+    description?: string;
+    values: Array<EnumValueConfig>;
+}
+
+// Sidebar tree written by the generator, branches sorted by name
+export interface NavigationBranchConfig {
+    name: string;
+    path: IPath;
+    // Classes below this branch
+    count: number;
+    // Set on leaves: what they document and its index in the data
+    kind?: 'class';
+    index?: number;
+    children?: NavigationBranchConfig[];
+}
+
+export interface NavigationConfig {
+    classes: NavigationBranchConfig;
+}
@@ -1,5 +1,5 @@
 import {dataService} from '../services/DataService';
-import {ObjectConfig, ITreeData, TreeItemConfig, ClassConfig} from '../types/types';
+import {ObjectConfig, ITreeData, TreeItemConfig, ClassConfig, NavigationBranchConfig, NavigationConfig} from '../types/types';
 
 // Helper function to create a new tree item
 const createTreeItem = (id: string, name: string, path: string): TreeItemConfig => ({
@@ -40,7 +40,9 @@ const processItem = (item: ObjectConfig, topLevelRoutes: Map<string, TreeItemCon
             functions: item.functions,
             properties: item.properties,
             nodes: item.nodes,
+            hierarchyIndex: item.hierarchyIndex,
             classHierarchy: item.classHierarchy,
+            inherited: item.inherited,
         });
     }
 };
@@ -68,3 +70,22 @@ export const generateTreeData = async (): Promise<ITreeData> => {
         throw error;  // Rethrow or handle as necessary
     }
 };
+
+// Tree items from the generated navigation, names only; the members come with the full data
+const fromNavigation = (branch: NavigationBranchConfig): TreeItemConfig => ({
+    ...createTreeItem(branch.index !== undefined ? branch.name : branch.path, branch.name, branch.path),
+    children: (branch.children ?? []).map(fromNavigation),
+});
+
+export const loadNavigationTree = async (): Promise<ITreeData | null> => {
+    try {
+        const response = await fetch(`${process.env.PUBLIC_URL}/navigation/index.json`);
+        if (!response.ok) {
+            return null;
+        }
+        const navigation = (await response.json()) as NavigationConfig;
+        return (navigation.classes.children ?? []).map(fromNavigation);
+    } catch {
+        return null;
+    }
+};